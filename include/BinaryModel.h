@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ModelView.h"
+
+class Predictor;
+
+// Binary model file, designed to be mmap'ed and used in place. All offsets
+// are in bytes from the start of the file; the node array starts on a
+// 64-byte boundary, so it is cache-line aligned once mapped.
+//
+//   BinaryModelHeader
+//   uint32_t roots[n_trees]        arena index of each tree's root
+//   uint32_t order[n_trees]        early-exit visiting order (Forest::reorder_trees),
+//                                  only when order_offset is non-zero
+//   ForestNode nodes[n_nodes]      the packed arena built by Forest, with
+//                                  the scaler folded into its bounds
+struct BinaryModelHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;    // BINARY_MODEL_BYTE_ORDER as written by the producer
+    uint32_t n_features;
+    uint32_t n_trees;
+    uint32_t n_nodes;
+    int32_t classes[2];
+    uint32_t reserved;
+    uint64_t roots_offset;
+    uint64_t nodes_offset;
+    uint64_t order_offset;  // 0 when the trees are visited in stored order
+};
+
+constexpr char BINARY_MODEL_MAGIC[8] = {'P', 'P', 'M', 'O', 'D', 'E', 'L', '\0'};
+constexpr uint32_t BINARY_MODEL_VERSION = 3;
+constexpr uint32_t BINARY_MODEL_BYTE_ORDER = 0x01020304;
+
+// Converts a loaded Predictor (scaler folded into the forest) to the binary format
+void write_binary_model(const Predictor& predictor, const std::string& path);
+
+// A binary model file mapped read-only into memory. Predictions walk the
+// mapping directly; nothing is parsed or copied. Only the small early-exit
+// tables (see VoteSwing) are computed when the file is opened.
+class MappedModel {
+private:
+    void* data;
+    size_t size;
+    std::vector<double> rest_min;
+    std::vector<double> rest_max;
+    ModelView model;
+
+    MappedModel(void* data, size_t size) : data(data), size(size), model(nullptr, 0, nullptr, 0, nullptr) {}
+public:
+    MappedModel(const MappedModel&) = delete;
+    MappedModel& operator=(const MappedModel&) = delete;
+    MappedModel(MappedModel&& other) noexcept;
+    ~MappedModel();
+
+    int predict(const FeatureArray& features) const { return this->model.predict(features); }
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const {
+        this->model.predict_batch(features, out);
+    }
+    const ModelView& view() const { return this->model; }
+
+    static MappedModel open(const std::string& path);
+};
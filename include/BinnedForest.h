@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "ForestEngine.h"
+#include "Sample.h"
+
+class Forest;
+
+// Per-feature ranks of a sample (BinnedForest::bin), 26 bytes against the
+// 104 of a FeatureArray
+using BinnedRow = std::array<uint16_t, N_FEATURES>;
+
+// Node of BinnedForest, in the preorder of Tree::get_nodes: the left child
+// is the next node. Internal nodes compare the sample's rank on `feature`
+// with `rank`; leaves have feature BINNED_LEAF and a vote index in `payload`.
+struct BinnedNode {
+    uint16_t rank;      // go left iff the sample's rank <= rank
+    uint8_t feature;
+    uint32_t payload;   // internal: right child is this + payload
+};
+
+constexpr uint8_t BINNED_LEAF = 0xFF;
+
+static_assert(sizeof(BinnedNode) == 8, "a BinnedNode must stay 8 bytes");
+
+// Engine over per-feature threshold ranks. The distinct bounds of each
+// feature are sorted once; a sample's rank on a feature is the number of
+// them it does not go left at, found by one branchless binary search per
+// feature. `x <= bounds[k]` holds exactly when that rank is <= k (NaN ranks
+// past every bound and goes right), so the trees compare small integers
+// and give the labels of the double walk.
+class BinnedForest : public ForestEngine {
+private:
+    // Sorted distinct bounds of feature f occupy [offsets[f], offsets[f + 1])
+    std::array<uint32_t, N_FEATURES + 1> offsets;
+    std::vector<double> bounds;
+
+    std::vector<BinnedNode> nodes;
+    std::vector<uint32_t> roots;
+    std::vector<std::array<double, 2>> leaf_votes;
+    std::vector<int> classes;
+public:
+    int predict(const FeatureArray& features) const override;
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const override;
+    static BinnedForest from_forest(const Forest& forest);
+
+    BinnedRow bin(const FeatureArray& features) const;
+
+    // Scores rows binned ahead of time, e.g. a large file binned once and
+    // kept in the compact form
+    int predict_binned(const BinnedRow& row) const;
+    void predict_binned(std::span<const BinnedRow> rows, std::span<int> out) const;
+
+    size_t node_count() const { return this->nodes.size(); }
+    size_t bin_count(size_t feature) const { return this->offsets[feature + 1] - this->offsets[feature]; }
+};
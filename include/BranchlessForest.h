@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ForestEngine.h"
+#include "Sample.h"
+
+class Forest;
+
+// Branch-free traversal engine. Each tree is padded to a complete binary tree
+// of its maximum depth, so a walk is a fixed number of steps
+// `node = 2 * node + 1 + !(x <= bound)` with no data-dependent branch, after
+// which the bottom-level index is mapped to the original leaf. Bounds have
+// the 1e-5 tie rule folded in (see Tree::left_bound).
+class BranchlessForest : public ForestEngine {
+private:
+    // Tree t: depths[t] levels, internal nodes from node_offsets[t] in
+    // level order, bottom-level slots from slot_offsets[t]
+    std::vector<uint8_t> depths;
+    std::vector<uint32_t> node_offsets;
+    std::vector<uint32_t> slot_offsets;
+
+    std::vector<double> bounds;
+    std::vector<uint8_t> features;
+    std::vector<uint32_t> slot_leaves;      // bottom-level slot -> index into leaf_votes
+    std::vector<std::array<double, 2>> leaf_votes;
+
+    std::vector<int> classes;
+public:
+    // Deepest tree from_forest accepts; padding doubles the slots per level
+    static constexpr uint32_t MAX_DEPTH = 20;
+
+    int predict(const FeatureArray& features) const override;
+
+    // Throws std::invalid_argument for a tree deeper than MAX_DEPTH
+    static BranchlessForest from_forest(const Forest& forest);
+
+    size_t padded_node_count() const { return this->bounds.size() + this->slot_leaves.size(); }
+};
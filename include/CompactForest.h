@@ -0,0 +1,28 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "CompactNode.h"
+#include "ForestEngine.h"
+#include "Sample.h"
+
+class Forest;
+
+// Engine over the trees' compact preorder encoding (Tree::get_nodes): 16-byte
+// nodes, left child implicit, all trees back to back in one array. The
+// embedded model's trees take 0.8-1.5 KB each, against about twice that
+// in the 32-byte arena.
+class CompactForest : public ForestEngine {
+private:
+    std::vector<CompactNode> nodes;
+    std::vector<uint32_t> roots;
+    std::vector<std::array<double, 2>> leaf_votes;
+    std::vector<int> classes;
+public:
+    int predict(const FeatureArray& features) const override;
+    static CompactForest from_forest(const Forest& forest);
+
+    size_t node_count() const { return this->nodes.size(); }
+};
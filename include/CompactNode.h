@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Sample.h"
+
+// Node of a tree's compact preorder encoding (see Tree::get_nodes). The left
+// child of an internal node is always the next node, so only the offset to
+// the right child is stored; a leaf keeps the index of its votes instead.
+struct CompactNode {
+    double bound;       // go left iff x <= bound (Tree::bound)
+    uint32_t payload;   // internal: right child is this + payload; leaf: vote index
+    uint8_t feature;    // COMPACT_LEAF for leaves
+};
+
+constexpr uint8_t COMPACT_LEAF = 0xFF;
+
+static_assert(sizeof(CompactNode) == 16, "a CompactNode must stay 16 bytes");
+
+// Vote index of the leaf reached from the tree starting at `root`
+inline uint32_t compact_leaf(const CompactNode* root, const FeatureArray& features) {
+    const CompactNode* node = root;
+
+    while (node->feature != COMPACT_LEAF) {
+        if (features[node->feature] <= node->bound) {
+            node += 1;
+        } else {
+            node += node->payload;
+        }
+    }
+
+    return node->payload;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <span>
+
+#include "Sample.h"
+
+// A Predictor compiled to C++ by tools/forest_codegen.cpp. Build with
+// `make COMPILED_MODEL=1` to link the generated model into pp and
+// benchmark_runner; there is no model to load or parse at startup.
+namespace compiled_model {
+    // Same as Predictor::predict: raw features, the scaler is folded in
+    int predict(const FeatureArray& features);
+
+    // predict() over every row, one label per row into `out`
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "CompactNode.h"
+#include "Sample.h"
+
+class Forest;
+
+// 8-byte node of FloatForest, in the same preorder as CompactNode: the left
+// child is the next node. `word` holds the feature in its low 8 bits
+// (COMPACT_LEAF for leaves) and the right-child offset or vote index above.
+struct FloatNode {
+    float bound;        // go left iff x <= bound
+    uint32_t word;
+};
+
+static_assert(sizeof(FloatNode) == 8, "a FloatNode must stay 8 bytes");
+
+// How FloatForest::from_forest rounded the thresholds. Each bound becomes
+// the largest float not above it, which sends every float input the same
+// way as the double bound. An exact node also sends every double input the
+// same way once it is rounded to float; `inexact` lists the (tree, preorder
+// node) pairs where no float can, since doubles just above the bound round
+// down onto it.
+struct FloatRounding {
+    size_t nodes = 0;
+    size_t exact = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> inexact;
+};
+
+// Float32 inference over a Forest: half the node size of CompactForest and
+// float features. Leaf votes stay double and add up in tree order, so
+// predict(to_float(x)) is the label Forest::predict gives the double value
+// of to_float(x), and the label for x itself wherever the path only meets
+// exact nodes. Not a ForestEngine, since it cannot match the double
+// engines on every double input.
+//
+// predict_batch walks 8 rows per tree in one AVX2 register, gathering each
+// lane's node, bound and feature value, which is twice the lanes of the
+// double gather engine. Labels are those of predict.
+class FloatForest {
+private:
+    std::vector<FloatNode> nodes;
+    std::vector<uint32_t> roots;
+    std::vector<std::array<double, 2>> leaf_votes;
+    std::vector<int> classes;
+
+    FloatRounding rounding;
+
+    void predict_avx2(std::span<const FeatureArrayF> features, std::span<int> out) const;
+public:
+    int predict(const FeatureArrayF& features) const;
+
+    // Uses the AVX2 kernel where the CPU supports it
+    void predict_batch(std::span<const FeatureArrayF> features, std::span<int> out) const;
+
+    // predict_batch pinned to the AVX2 kernel; throws if the CPU lacks AVX2
+    void predict_batch_avx2(std::span<const FeatureArrayF> features, std::span<int> out) const;
+    static FloatForest from_forest(const Forest& forest);
+
+    // Largest float not above `bound`
+    static float float_bound(double bound);
+
+    const FloatRounding& get_rounding() const { return this->rounding; }
+    size_t node_count() const { return this->nodes.size(); }
+};
@@ -1,25 +1,245 @@
 ﻿#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "AlignedAllocator.h"
+#include "ForestEngine.h"
+#include "ForestNode.h"
+#include "LookupForest.h"
 #include "Scaler.h"
 #include "Sample.h"
 #include "Tree.h"
 #include "json.hpp"
 
+// Mean tree walks per calibration sample with early exit, before and after
+// Forest::reorder_trees
+struct ReorderReport {
+    double mean_trees_before;
+    double mean_trees_after;
+};
+
+// Result of Forest::predict_within. `margin` is yes - no over the trees
+// used; `decided` means the label is the one the full forest gives.
+struct AnytimeVote {
+    int label;
+    size_t trees_used;
+    double margin;
+    bool decided;
+};
+
+// Two-stage cascade (Forest::calibrate_cascade). The first `prefix_trees`
+// in visiting order score every row; a row whose partial margin yes - no is
+// above band_high or below band_low takes that sign, the others go on
+// through the rest of the forest. prefix_trees == 0 disables the cascade.
+struct CascadeConfig {
+    size_t prefix_trees = 0;
+    double band_low = 0.0;
+    double band_high = 0.0;
+};
+
+// Rows scored by a cascade and how many the first stage passed on
+struct CascadeStats {
+    size_t rows = 0;
+    size_t passed = 0;
+    double mean_trees = 0.0;
+};
+
+// Passes of Forest::optimise, each switchable. None changes a prediction.
+// Leaf margins give way to early exit, interleaving and group prefetch when
+// those are set (see Forest::predict).
+struct OptimiseOptions {
+    bool fold_epsilon = true;       // one comparison per node (Tree::fold_epsilon)
+    bool prune_dead = true;         // tests an ancestor already decides
+    bool collapse_identical = true; // tests between two identical subtrees
+    bool drop_node_samples = true;  // training counts, unused at inference
+    bool leaf_margins = true;       // one add of yes - no per tree (LeafMargins)
+    bool share_subtrees = true;     // one arena copy of each distinct subtree
+};
+
+// Node counts before and after Forest::optimise and what each pass did
+struct OptimiseReport {
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    size_t thresholds_folded = 0;
+    size_t dead_removed = 0;
+    size_t collapsed = 0;
+    size_t arena_before = 0;        // arena slots, padding included
+    size_t arena_after = 0;
+};
+
 class Forest {
+public:
+    // Inference engines selectable at runtime. Arena walks the packed arena
+    // below; the others are built from the trees on demand.
+    enum class Engine { Arena, QuickScorer, Branchless, Compact, Binned, Gather, Gemm, Lookup };
 private:
     int n_estimators;
     int n_classes;
     int n_features;
     std::vector<int> classes;
     std::vector<Tree> trees;
+
+    // Every node of every tree, packed contiguously and built from `trees` at
+    // load time. `roots` holds the arena index of each tree's root.
+    std::vector<ForestNode, AlignedAllocator<ForestNode>> arena;
+    std::vector<uint32_t> roots;
+
+    ArenaTiling tiling;
+
+    // Early-exit tables of the arena (see VoteSwing), used when early_exit is
+    // set. Trees are visited in eval_order (empty: stored order); `trees`
+    // itself keeps the model's order, which defines how votes are summed.
+    std::vector<double> vote_rest_min;
+    std::vector<double> vote_rest_max;
+    double vote_slack = 0.0;
+    std::vector<uint32_t> eval_order;
+    double expected_trees = 0.0;
+    bool early_exit = false;
+
+    CascadeConfig cascade;
+    bool leaf_margins = false;
+    bool shared_arena = false;
+    size_t interleave = 0;
+    size_t prefetch_group = 0;
+    size_t hot_budget = 0;
+    size_t hot_levels = 0;
+    size_t lookup_levels = LookupForest::DEFAULT_LEVELS;
+    size_t hot_bytes = 0;
+
+    ArenaVote cascade_vote(const FeatureArray& features) const;
+
+    void build_vote_swing();
+    VoteSwing vote_swing(bool enabled) const;
+
+    Engine engine = Engine::Arena;
+    std::shared_ptr<const ForestEngine> engine_impl;
+
+    void build_arena();
+    void build_tree_arena();
+    void build_shared_arena();
+    void pack_hot_levels();
 public:
+    // With the arena engine, predict and predict_batch use the first mode
+    // set of: the cascade, early exit, then interleaving (predict) or group
+    // prefetch (predict_batch), then leaf margins, then the plain walk.
+    // Every mode gives the same labels except the cascade off its
+    // calibration set.
     int predict(const FeatureArray& features) const;
+
+    // Trees predict_within walks between reads of the clock
+    static constexpr size_t DEADLINE_STRIDE = 8;
+
+    // Walks the arena in the early-exit order until the vote is decided or
+    // `budget` has elapsed, whichever comes first; at least one tree is
+    // always walked. The deadline is checked after the first tree and every
+    // DEADLINE_STRIDE trees after it, so it can be overrun by up to
+    // DEADLINE_STRIDE - 1 walks. An undecided label is the sign of the
+    // margin so far. Ignores the selected engine.
+    AnytimeVote predict_within(const FeatureArray& features, std::chrono::nanoseconds budget) const;
+
+    // Scores every row of `features` into the matching slot of `out`, leaving
+    // the engine free to order the work across rows. Same labels as predict().
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const;
     static Forest from_json(const nlohmann::json& d_info);
 
+    // Moves every tree into raw feature space (see Tree::fold_scaler), after
+    // which predict() takes unscaled features. Call at most once.
+    void fold_scaler(const Scaler& scaler);
+
+    // Walks `group` trees in lockstep in the arena engine's predict (see
+    // predict_arena_interleaved) to cut single-sample latency; 0 turns it
+    // off. Early exit and the cascade take precedence. At most MAX_INTERLEAVE.
+    void set_interleave(size_t group);
+    size_t get_interleave() const { return this->interleave; }
+
+    // Runs the arena engine's predict_batch with `group` rows in flight,
+    // prefetching each one's next node (see predict_arena_amac); 0 turns it
+    // off. Early exit and the cascade take precedence.
+    void set_prefetch_group(size_t group) { this->prefetch_group = group; }
+    size_t get_prefetch_group() const { return this->prefetch_group; }
+
+    // Load-time rewrite of the trees for inference; run after fold_scaler,
+    // which needs unfolded thresholds. Leaf margins apply to the arena
+    // engine without early exit.
+    OptimiseReport optimise(OptimiseOptions options = {});
+    bool get_leaf_margins() const { return this->leaf_margins; }
+    bool get_shared_arena() const { return this->shared_arena; }
+
+    // L1 data cache size of most x86 cores, a budget to pass to
+    // set_hot_table_budget. Not applied unless passed: the budget starts at 0.
+    static constexpr size_t HOT_TABLE_BUDGET = 32 * 1024;
+
+    // Packs the top levels of every tree into one block at the front of the
+    // arena, ahead of the deeper nodes: as many whole levels as fit in
+    // `bytes`, 0 (or a budget below one level) keeping each tree contiguous.
+    // Rebuilds the arena; labels are unchanged. Off by default, and it
+    // brings no benefit on the embedded forest: it has not been measured
+    // with hardware counters, the "[cache]" benchmark's L1D model shows no
+    // drop in misses, and throughput is flat or lower. Sibling pairs fill
+    // whole lines in either layout, so packing touches no fewer lines.
+    void set_hot_table_budget(size_t bytes);
+    size_t get_hot_table_budget() const { return this->hot_budget; }
+    // Levels and bytes the budget bought, 0 when nothing is packed
+    size_t get_hot_levels() const { return this->hot_levels; }
+    size_t hot_table_bytes() const { return this->hot_bytes; }
+
+    // Tile sizes of the arena engine's predict_batch (see predict_arena_batch).
+    // Both must be non-zero.
+    void set_tiling(ArenaTiling tiling);
+    ArenaTiling get_tiling() const { return this->tiling; }
+
+    // Lets the arena engine stop summing once the remaining trees cannot
+    // overturn the vote. Labels are unchanged; other engines ignore it.
+    void set_early_exit(bool enabled) { this->early_exit = enabled; }
+    bool get_early_exit() const { return this->early_exit; }
+
+    // Model-preparation pass: picks the order early exit visits the trees in,
+    // trees with a wide leaf-vote spread that agree with the forest on
+    // `calibration` first. The order is kept only if it lowers the mean
+    // number of trees walked. Labels never change.
+    ReorderReport reorder_trees(std::span<const FeatureArray> calibration);
+
+    // Mean trees walked per row with early exit in the current order
+    double mean_trees_evaluated(std::span<const FeatureArray> rows) const;
+
+    // Picks the band for a `prefix_trees` cascade so that every row of
+    // `calibration` gets the full forest's label. Rows outside the
+    // calibration set can still differ; see set_early_exit for an exact mode.
+    CascadeConfig calibrate_cascade(std::span<const FeatureArray> calibration, size_t prefix_trees) const;
+
+    // Routes the arena engine's predict and predict_batch through the cascade
+    void set_cascade(CascadeConfig cascade);
+    CascadeConfig get_cascade() const { return this->cascade; }
+
+    // Per-stage pass-through of the current cascade on `rows`
+    CascadeStats cascade_stats(std::span<const FeatureArray> rows) const;
+
+    const std::vector<uint32_t>& get_eval_order() const { return this->eval_order; }
+    // Mean trees walked on the calibration set of the last reorder_trees, 0 if none
+    double get_expected_trees() const { return this->expected_trees; }
+
+    void set_engine(Engine engine);
+    Engine get_engine() const { return this->engine; }
+
+    // Table depth of the lookup engine (see LookupForest), 1 to
+    // LookupForest::MAX_LEVELS; rebuilds the engine if it is selected
+    void set_lookup_levels(size_t levels);
+    size_t get_lookup_levels() const { return this->lookup_levels; }
+    static Engine engine_from_name(const std::string& name);
+
     int get_n_features() const { return this->n_features; }
     int get_n_classes() const { return this->n_classes; }
     int get_n_estimators() const { return this->n_estimators; }
+    const std::vector<int>& get_classes() const { return this->classes; }
+    const std::vector<Tree>& get_trees() const { return this->trees; }
+    size_t arena_size() const { return this->arena.size(); }
+    const ForestNode* get_arena() const { return this->arena.data(); }
+    const std::vector<uint32_t>& get_roots() const { return this->roots; }
 
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(Forest, n_estimators, n_features, n_classes, classes, trees)
+    friend void to_json(nlohmann::json& j, const Forest& f);
+    friend void from_json(const nlohmann::json& j, Forest& f);
 };
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <span>
+
+#include "Sample.h"
+
+// Alternative inference engine for a loaded Forest, selected at runtime with
+// Forest::set_engine. Engines are built from the forest's trees and must
+// return exactly what the arena walk in Forest::predict returns.
+class ForestEngine {
+public:
+    virtual ~ForestEngine() = default;
+    virtual int predict(const FeatureArray& features) const = 0;
+
+    // One label per row; `out` has already been checked to match `features`.
+    // Engines that can share work across rows override this.
+    virtual void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const {
+        for (size_t i = 0; i < features.size(); i++) {
+            out[i] = this->predict(features[i]);
+        }
+    }
+};
@@ -0,0 +1,425 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Sample.h"
+
+// Fixed-size node record of the packed forest arena. Internal nodes use
+// `feature`, `bound` and `left`, and send the sample left when
+// `x <= bound` (Tree::bound, epsilon rule folded in); leaves have
+// `feature == -1`, carry their (class 0, class 1) votes and keep their
+// precomputed margin yes - no in `bound`.
+struct alignas(32) ForestNode {
+    double bound;
+    int32_t feature;
+    uint32_t left;      // arena index of the left child, the right child is left + 1
+    double votes[2];
+};
+
+static_assert(sizeof(ForestNode) == 32, "two ForestNodes must share a cache line");
+
+// Leaf reached from the root at arena index `root`
+inline const ForestNode* arena_leaf(const ForestNode* arena, uint32_t root, const FeatureArray& features) {
+    const ForestNode* node = arena + root;
+
+    while (node->feature != -1) {
+        if (features[node->feature] <= node->bound) {
+            node = arena + node->left;
+        } else {
+            node = arena + node->left + 1;
+        }
+    }
+
+    return node;
+}
+
+// Early-exit tables of an arena. Trees are visited in `order` (tree index
+// per position, null for the stored order); rest_min[k] and rest_max[k]
+// bound the change in yes - no that positions k, k + 1, ... can still make
+// (n_trees + 1 entries each, the last one 0). Null tables disable early exit.
+struct VoteSwing {
+    const double* rest_min = nullptr;
+    const double* rest_max = nullptr;
+    double slack = 0.0;     // covers the rounding of the running sums
+    const uint32_t* order = nullptr;
+};
+
+// Fills the VoteSwing tables of an arena from its leaf votes and returns
+// the slack. The slack is far above the rounding error of summing a few
+// hundred votes in double, so a decision taken early is the decision the
+// full sum would have reached, whatever order the trees are visited in.
+inline double compute_vote_swing(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    std::vector<double>& rest_min,
+    std::vector<double>& rest_max,
+    const uint32_t* order = nullptr
+) {
+    rest_min.assign(n_trees + 1, 0.0);
+    rest_max.assign(n_trees + 1, 0.0);
+    double magnitude = 0.0;
+
+    for (size_t k = n_trees; k-- > 0;) {
+        double low = INFINITY;
+        double high = -INFINITY;
+        double largest = 0.0;
+
+        std::vector<uint32_t> stack = {roots[order ? order[k] : k]};
+        while (!stack.empty()) {
+            const auto& node = arena[stack.back()];
+            stack.pop_back();
+
+            if (node.feature != -1) {
+                stack.push_back(node.left);
+                stack.push_back(node.left + 1);
+                continue;
+            }
+
+            low = std::min(low, node.votes[1] - node.votes[0]);
+            high = std::max(high, node.votes[1] - node.votes[0]);
+            largest = std::max(largest, std::abs(node.votes[0]) + std::abs(node.votes[1]));
+        }
+
+        rest_min[k] = rest_min[k + 1] + low;
+        rest_max[k] = rest_max[k + 1] + high;
+        magnitude += largest;
+    }
+
+    return 1e-9 * magnitude;
+}
+
+// +1 once the class 1 vote can no longer lose, -1 once it can no longer
+// win, 0 while positions `next`, `next + 1`, ... can still overturn the margin
+inline int vote_outcome(const VoteSwing& swing, size_t next, double no_votes, double yes_votes) {
+    const auto margin = yes_votes - no_votes;
+
+    if (margin + swing.rest_min[next] > swing.slack) {
+        return 1;
+    } else if (margin + swing.rest_max[next] < -swing.slack) {
+        return -1;
+    }
+
+    return 0;
+}
+
+// Outcome of one arena walk: the label, how many tree walks it took and
+// the votes summed by the time it stopped
+struct ArenaVote {
+    int label;
+    size_t trees;
+    double no_votes;
+    double yes_votes;
+};
+
+// Walks the `n_trees` trees rooted at `roots` in a packed arena and returns
+// the winning class, exactly like Tree::predict summed over the trees. With
+// VoteSwing tables it stops as soon as the remaining trees cannot change
+// the outcome. A vote left within the slack after visiting the trees out of
+// order is summed again in tree order, which defines the label.
+inline ArenaVote arena_vote(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    const FeatureArray& features,
+    const VoteSwing& swing = {}
+) {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (size_t k = 0; k < n_trees; k++) {
+        const ForestNode* node = arena_leaf(arena, roots[swing.order ? swing.order[k] : k], features);
+
+        no_votes += node->votes[0];
+        yes_votes += node->votes[1];
+
+        if (swing.rest_min) {
+            if (auto outcome = vote_outcome(swing, k + 1, no_votes, yes_votes)) {
+                return {outcome > 0 ? classes[1] : classes[0], k + 1, no_votes, yes_votes};
+            }
+        }
+    }
+
+    if (swing.order) {
+        auto in_order = arena_vote(arena, roots, n_trees, classes, features);
+        in_order.trees += n_trees;
+        return in_order;
+    }
+
+    return {yes_votes >= no_votes ? classes[1] : classes[0], n_trees, no_votes, yes_votes};
+}
+
+inline int predict_arena(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    const FeatureArray& features,
+    const VoteSwing& swing = {}
+) {
+    return arena_vote(arena, roots, n_trees, classes, features, swing).label;
+}
+
+// Most trees predict_arena_interleaved advances together
+constexpr size_t MAX_INTERLEAVE = 16;
+
+// predict_arena with `group` (1 to MAX_INTERLEAVE) trees walked in lockstep,
+// one level per step. A step issues the group's node loads back to back, so
+// their cache misses overlap instead of forming one dependent chain per
+// tree; a tree that reached its leaf stays on it. Votes are added in tree
+// order, so the label is the one predict_arena gives.
+inline int predict_arena_interleaved(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    const FeatureArray& features,
+    size_t group
+) {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+    uint32_t at[MAX_INTERLEAVE];
+
+    for (size_t first = 0; first < n_trees; first += group) {
+        const auto count = std::min(group, n_trees - first);
+
+        for (size_t j = 0; j < count; j++) {
+            at[j] = roots[first + j];
+        }
+
+        for (bool moving = true; moving;) {
+            moving = false;
+
+            for (size_t j = 0; j < count; j++) {
+                const ForestNode& node = arena[at[j]];
+                const bool internal = node.feature != -1;
+                const bool right = !(features[internal ? node.feature : 0] <= node.bound);
+
+                at[j] = internal ? node.left + right : at[j];
+                moving |= internal;
+            }
+        }
+
+        for (size_t j = 0; j < count; j++) {
+            no_votes += arena[at[j]].votes[0];
+            yes_votes += arena[at[j]].votes[1];
+        }
+    }
+
+    return yes_votes >= no_votes ? classes[1] : classes[0];
+}
+
+// Leaf-margin accumulation (Forest::optimise): a row sums the leaves' yes - no
+// margins, one add per tree, instead of two class sums. The summed margin
+// can round differently from the difference of the two sums, so a margin
+// within `slack` of zero (the VoteSwing slack) is summed again by
+// arena_vote.
+struct LeafMargins {
+    bool enabled = false;
+    double slack = 0.0;
+};
+
+inline int predict_arena_margin(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    const FeatureArray& features,
+    double slack
+) {
+    double margin = 0.0;
+
+    for (size_t t = 0; t < n_trees; t++) {
+        margin += arena_leaf(arena, roots[t], features)->bound;
+    }
+
+    if (margin > slack) {
+        return classes[1];
+    } else if (margin < -slack) {
+        return classes[0];
+    }
+
+    return predict_arena(arena, roots, n_trees, classes, features);
+}
+
+// Tile sizes of predict_arena_batch. A tree tile is a run of consecutive
+// trees, which are contiguous in the arena; 16 trees of the embedded model
+// take about 40 KB. A sample tile is the block of rows whose vote
+// accumulators stay live while it goes through every tree tile.
+struct ArenaTiling {
+    size_t trees = 16;
+    size_t samples = 256;
+};
+
+// predict_arena over every row of `features`, one label per row into `out`.
+// Each sample tile is run through one tree tile before moving on to the
+// next, so a tile's nodes stay cached across the whole block instead of the
+// full model streaming through the cache for every row. Votes still add up
+// in tree order, so the labels are exactly those of predict_arena. With
+// VoteSwing tables, tiles run over visiting positions and rows decided early
+// skip the remaining tiles. Without VoteSwing tables, `margins` switches the
+// rows to leaf-margin accumulation.
+inline void predict_arena_batch(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    std::span<const FeatureArray> features,
+    std::span<int> out,
+    ArenaTiling tiling = {},
+    const VoteSwing& swing = {},
+    LeafMargins margins = {}
+) {
+    margins.enabled = margins.enabled && !swing.rest_min;
+
+    std::vector<double> votes(2 * tiling.samples);
+    std::vector<uint8_t> decided(tiling.samples);
+
+    for (size_t first = 0; first < features.size(); first += tiling.samples) {
+        const auto count = std::min(tiling.samples, features.size() - first);
+        const FeatureArray* block = features.data() + first;
+        size_t open = count;
+
+        std::fill(votes.begin(), votes.end(), 0.0);
+        std::fill(decided.begin(), decided.end(), 0);
+
+        for (size_t tile = 0; tile < n_trees && open > 0; tile += tiling.trees) {
+            const auto tile_end = std::min(tile + tiling.trees, n_trees);
+
+            for (size_t i = 0; i < count; i++) {
+                if (decided[i]) {
+                    continue;
+                }
+
+                const auto& sample = block[i];
+
+                for (size_t k = tile; k < tile_end; k++) {
+                    const ForestNode* node = arena_leaf(arena, roots[swing.order ? swing.order[k] : k], sample);
+
+                    if (margins.enabled) {
+                        votes[2 * i] += node->bound;
+                        continue;
+                    }
+
+                    votes[2 * i] += node->votes[0];
+                    votes[2 * i + 1] += node->votes[1];
+
+                    if (swing.rest_min) {
+                        if (auto outcome = vote_outcome(swing, k + 1, votes[2 * i], votes[2 * i + 1])) {
+                            out[first + i] = outcome > 0 ? classes[1] : classes[0];
+                            decided[i] = 1;
+                            open--;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            if (decided[i]) {
+                continue;
+            }
+
+            if (margins.enabled) {
+                const auto margin = votes[2 * i];
+                out[first + i] = margin > margins.slack ? classes[1]
+                    : margin < -margins.slack ? classes[0]
+                    : predict_arena(arena, roots, n_trees, classes, block[i]);
+            } else if (swing.order) {
+                out[first + i] = predict_arena(arena, roots, n_trees, classes, block[i]);
+            } else {
+                out[first + i] = votes[2 * i + 1] >= votes[2 * i] ? classes[1] : classes[0];
+            }
+        }
+    }
+}
+
+// predict_arena over every row of `features` in the style of asynchronous
+// memory access chaining: `group` rows are in flight at once, each walking
+// the trees in order. A visit takes one step for one row and prefetches the
+// node that row needs next before moving on to the next row, so the misses
+// of the group overlap and a row's node is likely cached by the time it
+// comes round again. A finished row hands its slot to the next unstarted
+// one. Votes add up per row in tree order, so the labels are those of
+// predict_arena.
+inline void predict_arena_amac(
+    const ForestNode* arena,
+    const uint32_t* roots,
+    size_t n_trees,
+    const int* classes,
+    std::span<const FeatureArray> features,
+    std::span<int> out,
+    size_t group
+) {
+    struct InFlight {
+        size_t row;
+        size_t tree;
+        uint32_t node;
+        double no_votes;
+        double yes_votes;
+    };
+
+    if (n_trees == 0) {
+        std::fill(out.begin(), out.end(), classes[1]);
+        return;
+    }
+
+    size_t next_row = 0;
+    auto start = [&](InFlight& state) {
+        if (next_row == features.size()) {
+            return false;
+        }
+
+        state = {next_row++, 0, roots[0], 0.0, 0.0};
+        return true;
+    };
+
+    std::vector<InFlight> ring(group);
+    size_t live = 0;
+    for (auto& state: ring) {
+        if (start(state)) {
+            __builtin_prefetch(arena + state.node);
+            live++;
+        } else {
+            state.row = SIZE_MAX;
+        }
+    }
+
+    while (live > 0) {
+        for (auto& state: ring) {
+            if (state.row == SIZE_MAX) {
+                continue;
+            }
+
+            const ForestNode& node = arena[state.node];
+
+            if (node.feature != -1) {
+                state.node = node.left + !(features[state.row][node.feature] <= node.bound);
+            } else {
+                state.no_votes += node.votes[0];
+                state.yes_votes += node.votes[1];
+
+                if (++state.tree < n_trees) {
+                    state.node = roots[state.tree];
+                } else {
+                    out[state.row] = state.yes_votes >= state.no_votes ? classes[1] : classes[0];
+
+                    if (!start(state)) {
+                        state.row = SIZE_MAX;
+                        live--;
+                        continue;
+                    }
+                }
+            }
+
+            __builtin_prefetch(arena + state.node);
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "ForestEngine.h"
+#include "ForestNode.h"
+#include "Sample.h"
+
+class Forest;
+
+// Batch engine over a copy of the forest's arena in which each AVX2 lane
+// follows a different sample through the same tree. A step gathers the
+// lanes' (feature, left) words and bounds, gathers each lane's feature
+// value, compares `x <= bound` (Tree::bound, epsilon rule folded in) and
+// blends in the next child; lanes already on a leaf are masked out of the
+// loads. Four double samples are in flight per tree, and their votes add up
+// lane by lane in tree order, so the labels are those of predict_arena.
+//
+// Without AVX2, and for single samples, it walks the arena like the arena
+// engine.
+class GatherForest : public ForestEngine {
+private:
+    std::vector<ForestNode, AlignedAllocator<ForestNode>> arena;
+    std::vector<uint32_t> roots;
+    std::vector<int> classes;
+
+    void predict_avx2(std::span<const FeatureArray> features, std::span<int> out) const;
+public:
+    int predict(const FeatureArray& features) const override;
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const override;
+    static GatherForest from_forest(const Forest& forest);
+};
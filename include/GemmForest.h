@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "AlignedAllocator.h"
+#include "ForestEngine.h"
+#include "ForestNode.h"
+#include "Sample.h"
+
+class Forest;
+
+// Forest evaluation as dense matrix products, after Hummingbird's GEMM
+// strategy. For each tree with I internal nodes and L leaves:
+//
+//   A  (13 x I)  one-hot feature selection, S = X A picks each node's feature
+//   B  (I)       bounds, T = (S <= B) is 1 where a node sends the row left
+//   C  (I x L)   +1 / -1 where a leaf lies under a node's left / right child
+//   D  (L)       left turns on the path to each leaf; T C == D only there
+//   V  (L x 2)   leaf votes, summed through the one-hot leaf row (T C == D) V
+//
+// Rows go through in blocks of GEMM_BLOCK with plain blocked kernels, no
+// BLAS, and predict is a block of one. A block's intermediates live in a
+// per-thread scratch that grows to GEMM_BLOCK x widest on a thread's first
+// block and whenever a wider forest is scored; once it has grown, scoring
+// does not allocate. Every product involves 0/1/-1 factors and finite
+// values only, so it is exact; rows with a non-finite feature (where
+// 0 * inf would poison X A) take the arena walk instead. Votes add up tree
+// by tree, so the labels are those of predict_arena.
+class GemmForest : public ForestEngine {
+private:
+    struct TreeMatrices {
+        size_t internal;
+        size_t leaves;
+        size_t a;       // offsets into `values`
+        size_t b;
+        size_t c;
+        size_t d;
+        size_t v;
+    };
+
+    std::vector<TreeMatrices> trees;
+    std::vector<double, AlignedAllocator<double>> values;
+
+    // Arena walk for single rows with non-finite features
+    std::vector<ForestNode, AlignedAllocator<ForestNode>> arena;
+    std::vector<uint32_t> roots;
+    std::vector<int> classes;
+
+    size_t widest = 0;  // most internal nodes or leaves of any tree
+
+    void predict_block(const FeatureArray* rows, size_t count, int* out) const;
+public:
+    int predict(const FeatureArray& features) const override;
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const override;
+    static GemmForest from_forest(const Forest& forest);
+
+    size_t matrix_size() const { return this->values.size(); }
+};
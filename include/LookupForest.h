@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "CompactNode.h"
+#include "ForestEngine.h"
+#include "Sample.h"
+
+class Forest;
+
+// One test of the top levels of a LookupForest tree, in heap order
+struct LookupCondition {
+    double bound;       // the sample goes right iff !(x <= bound)
+    uint8_t feature;
+};
+
+// Engine that replaces the top `levels` of each tree with a lookup table.
+// The 2^levels - 1 tests of those levels only depend on the sample, so they
+// are evaluated independently and packed into one bit word. The packed word
+// is not an index by itself: the exit of the top part is found by a
+// `levels`-step walk over its bits in a register, one shift per level with
+// no loads, and a table of 2^levels entries then gives the compact node
+// (Tree::get_nodes) where the walk carries on. A branch that ends above the
+// last table level fills the positions below it with tests that lead to the
+// same leaf either way.
+class LookupForest : public ForestEngine {
+private:
+    size_t levels;
+    size_t n_conditions;
+
+    // Per tree: n_conditions tests and 2^levels entry nodes, back to back
+    std::vector<LookupCondition> conditions;
+    std::vector<uint32_t> entries;
+
+    std::vector<CompactNode> nodes;
+    std::vector<uint32_t> roots;
+    std::vector<std::array<double, 2>> leaf_votes;
+    std::vector<int> classes;
+public:
+    // Most levels a table can cover; the tests must fit one 32-bit index
+    static constexpr size_t MAX_LEVELS = 5;
+
+    // Depth Forest uses unless told otherwise: the fastest in the "[lookup]"
+    // benchmark with the library built at -O2
+    static constexpr size_t DEFAULT_LEVELS = 2;
+
+    int predict(const FeatureArray& features) const override;
+
+    // Throws unless 1 <= levels <= MAX_LEVELS
+    static LookupForest from_forest(const Forest& forest, size_t levels = DEFAULT_LEVELS);
+
+    size_t get_levels() const { return this->levels; }
+    size_t table_bytes() const {
+        return this->conditions.size() * sizeof(LookupCondition) + this->entries.size() * sizeof(uint32_t);
+    }
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+#include "ForestNode.h"
+#include "Sample.h"
+
+// Read-only predictor over a packed model that lives elsewhere: a ForestNode
+// arena, with the scaler already folded into its bounds, and its tree roots.
+// It owns, allocates and parses nothing, so it can be a constinit object
+// over the constexpr tables in model_tables.h.
+class ModelView {
+private:
+    const ForestNode* nodes;
+    size_t n_nodes;
+    const uint32_t* roots;
+    size_t n_trees;
+    const int* classes;
+    VoteSwing swing;
+public:
+    // With `swing` tables, predictions stop early once the vote is decided
+    constexpr ModelView(
+        const ForestNode* nodes,
+        size_t n_nodes,
+        const uint32_t* roots,
+        size_t n_trees,
+        const int* classes,
+        VoteSwing swing = {}
+    ) : nodes(nodes), n_nodes(n_nodes), roots(roots), n_trees(n_trees), classes(classes), swing(swing) {}
+
+    // Same as Predictor::predict: raw, unscaled features
+    int predict(const FeatureArray& features) const {
+        return predict_arena(this->nodes, this->roots, this->n_trees, this->classes, features, this->swing);
+    }
+
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const {
+        if (features.size() != out.size()) {
+            throw std::invalid_argument("predict_batch needs one output slot per sample");
+        }
+
+        predict_arena_batch(this->nodes, this->roots, this->n_trees, this->classes, features, out, {}, this->swing);
+    }
+
+    size_t node_count() const { return this->n_nodes; }
+    size_t tree_count() const { return this->n_trees; }
+
+    // Checks that every root, child and feature index is in range and that
+    // children come after their parent, so a walk always terminates
+    constexpr bool is_valid() const {
+        for (size_t t = 0; t < this->n_trees; t++) {
+            if (this->roots[t] >= this->n_nodes) {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < this->n_nodes; i++) {
+            const auto& node = this->nodes[i];
+
+            if (node.feature == -1) {
+                continue;
+            }
+
+            if (node.feature < 0 || static_cast<size_t>(node.feature) >= N_FEATURES) {
+                return false;
+            }
+
+            if (node.left <= i || static_cast<size_t>(node.left) + 1 >= this->n_nodes) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include <string>
 #include "json.hpp"
+#include "BinaryModel.h"
 #include "Scaler.h"
 #include "Sample.h"
 #include "Forest.h"
 
+// Scaler + forest. Loading folds the scaler into the forest's thresholds
+// (Forest::fold_scaler), so predict() takes raw features and never scales,
+// then runs every Forest::optimise pass.
 class Predictor {
 private:
     Scaler scaler;
@@ -14,8 +19,31 @@ private:
 public:
     Predictor() = default;
 
-    int predict(FeatureArray& features) const;
+    int predict(const FeatureArray& features) const;
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const;
+
+    // Deadline-bounded prediction, see Forest::predict_within
+    AnytimeVote predict_within(const FeatureArray& features, std::chrono::nanoseconds budget) const {
+        return this->forest.predict_within(features, budget);
+    }
     static Predictor LoadEmbedded();
+
+    // The embedded model document, as from_json(const json&, Predictor&) reads it
+    static nlohmann::json EmbeddedJson();
+
+    // Maps a model written by write_binary_model; used in place, no parsing
+    static MappedModel LoadBinary(const std::string& path);
+
+    void set_engine(Forest::Engine engine) { this->forest.set_engine(engine); }
+    void set_early_exit(bool enabled) { this->forest.set_early_exit(enabled); }
+    void set_interleave(size_t group) { this->forest.set_interleave(group); }
+    void set_prefetch_group(size_t group) { this->forest.set_prefetch_group(group); }
+    void set_hot_table_budget(size_t bytes) { this->forest.set_hot_table_budget(bytes); }
+    void set_lookup_levels(size_t levels) { this->forest.set_lookup_levels(levels); }
+
+    const Scaler& get_scaler() const { return this->scaler; }
+    const Forest& get_forest() const { return this->forest; }
+
     friend void to_json(nlohmann::json& j, const Predictor& p);
     friend void from_json(const nlohmann::json& j, Predictor& p);
 };
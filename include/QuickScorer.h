@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "ForestEngine.h"
+#include "Sample.h"
+
+class Forest;
+
+// QuickScorer evaluation of a Forest. Every internal node becomes a
+// condition `feature > bound` stored per feature in ascending bound order,
+// together with a bitmask of the leaves that survive when the condition
+// holds. A sample clears leaves feature by feature, and each tree's exit
+// leaf is the lowest bit left set in its mask.
+//
+// predict_batch is the vectorised variant (V-QuickScorer): 8 samples per
+// AVX-512 register or 4 per AVX2 register share one pass over the
+// conditions, each comparison updating the masks of all lanes at once.
+class QuickScorer : public ForestEngine {
+private:
+    // Conditions of feature f occupy [offsets[f], offsets[f + 1])
+    std::array<uint32_t, N_FEATURES + 1> offsets;
+    std::vector<double> bounds;
+    std::vector<uint32_t> condition_trees;
+    std::vector<uint64_t> condition_masks;
+
+    // Leaves of tree t, left to right, start at leaf_offsets[t]
+    std::vector<uint32_t> leaf_offsets;
+    std::vector<std::array<double, 2>> leaf_votes;
+
+    std::vector<int> classes;
+
+    int vote(const uint64_t* leaves, size_t stride) const;
+    void predict_avx2(std::span<const FeatureArray> features, std::span<int> out) const;
+    void predict_avx512(std::span<const FeatureArray> features, std::span<int> out) const;
+public:
+    int predict(const FeatureArray& features) const override;
+
+    // Scores raw samples, writing one class label per sample.
+    // Uses the widest instruction set the CPU supports.
+    void predict_batch(std::span<const FeatureArray> features, std::span<int> out) const override;
+
+    // predict_batch pinned to one kernel, so each can be checked on a host
+    // that would dispatch to another. Throw if the CPU lacks the instructions.
+    void predict_batch_avx2(std::span<const FeatureArray> features, std::span<int> out) const;
+    void predict_batch_avx512(std::span<const FeatureArray> features, std::span<int> out) const;
+    static QuickScorer from_forest(const Forest& forest);
+
+    size_t condition_count() const { return this->bounds.size(); }
+    size_t tree_count() const { return this->leaf_offsets.size(); }
+};
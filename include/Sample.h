@@ -7,6 +7,17 @@
 constexpr size_t N_FEATURES = 13;
 using FeatureArray = std::array<double, N_FEATURES>;
 
+// Float counterpart of FeatureArray, scored by FloatForest
+using FeatureArrayF = std::array<float, N_FEATURES>;
+
+inline FeatureArrayF to_float(const FeatureArray& features) {
+    FeatureArrayF out;
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        out[f] = static_cast<float>(features[f]);
+    }
+    return out;
+}
+
 struct Sample {
     double Nep_index;
     double YE;
@@ -11,5 +11,13 @@ private:
     std::vector<double> mean;
 public:
     void transform(FeatureArray& data) const;
+
+    // Largest raw value of `feature` that transform() maps to <= `bound`, so
+    // `x <= raw_bound(f, b)` decides exactly like the scaled comparison
+    double raw_bound(size_t feature, double bound) const;
+
+    const std::vector<double>& get_scale() const { return this->scale; }
+    const std::vector<double>& get_mean() const { return this->mean; }
+
     NLOHMANN_DEFINE_TYPE_INTRUSIVE(Scaler, scale, mean)
 };
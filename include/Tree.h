@@ -1,9 +1,19 @@
 ﻿#pragma once
+#include <array>
 #include <vector>
 
 #include "json.hpp"
+#include "CompactNode.h"
 #include "Sample.h"
 
+class Scaler;
+
+// Internal nodes removed by Tree::simplify
+struct SimplifyStats {
+    size_t dead = 0;        // tests the path to them already decides
+    size_t collapsed = 0;   // tests between two identical subtrees
+};
+
 class Tree {
 private:
     std::vector<int> feature;
@@ -12,8 +22,62 @@ private:
     std::vector<int> children_right;
     std::vector<std::tuple<double, double>> value;
     std::vector<int> n_node_samples;
+
+    // Once folded, `threshold` holds inclusive left bounds
+    bool folded = false;
+
+    // Runtime encoding that predict() walks, rebuilt from the arrays above
+    // whenever they change. Nodes are in preorder; leaf votes in leaf order.
+    std::vector<CompactNode> nodes;
+    std::vector<std::array<double, 2>> leaf_votes;
+
+    void build_nodes();
+
+    int simplify_node(
+        int node, std::vector<double>& lo, std::vector<double>& hi,
+        bool prune_dead, bool collapse_identical, SimplifyStats& stats
+    );
+    bool same_subtree(int a, int b) const;
 public:
     friend void to_json(nlohmann::json& j, const Tree& t);
     friend void from_json(const nlohmann::json& j, Tree& t);
     std::tuple<double, double> predict(const FeatureArray& features) const;
+
+    // Largest value that predict() sends left at `threshold`, with the 1e-5
+    // tie rule folded in: `x <= left_bound(t)` matches predict() for every x.
+    static double left_bound(double threshold);
+
+    // Left bound of `node`, whether or not the tree is folded
+    double bound(int node) const {
+        return this->folded ? this->threshold[node] : left_bound(this->threshold[node]);
+    }
+
+    // Rewrites thresholds as left bounds (the epsilon rule folded in)
+    void fold_epsilon();
+
+    // Rewrites thresholds into raw feature space so that predict() on raw
+    // features decides exactly like predict() on scaler-transformed ones.
+    // Throws if the tree is already folded.
+    void fold_scaler(const Scaler& scaler);
+    bool is_folded() const { return this->folded; }
+
+    // Removes internal nodes that cannot change the leaf a sample reaches:
+    // tests whose outcome the path above them fixes (`prune_dead`) and tests
+    // whose two subtrees are identical (`collapse_identical`). Predictions
+    // are unchanged; nodes are renumbered in preorder.
+    SimplifyStats simplify(bool prune_dead, bool collapse_identical);
+
+    // Frees the training sample counts, which inference never reads.
+    // to_json leaves them out afterwards.
+    void drop_node_samples();
+
+    size_t node_count() const { return this->feature.size(); }
+    const std::vector<int>& get_feature() const { return this->feature; }
+    const std::vector<double>& get_threshold() const { return this->threshold; }
+    const std::vector<int>& get_children_left() const { return this->children_left; }
+    const std::vector<int>& get_children_right() const { return this->children_right; }
+    const std::vector<std::tuple<double, double>>& get_value() const { return this->value; }
+
+    const std::vector<CompactNode>& get_nodes() const { return this->nodes; }
+    const std::vector<std::array<double, 2>>& get_leaf_votes() const { return this->leaf_votes; }
 };
@@ -0,0 +1,6193 @@
+// Generated by forest_codegen --tables from the embedded model. Do not edit;
+// regenerate with `make model-tables`.
+#pragma once
+
+#include <cstdint>
+
+#include "ModelView.h"
+
+namespace model_tables {
+
+static_assert(N_FEATURES == 13, "model expects 13 features");
+
+inline constexpr int classes[2] = {0, 1};
+
+inline constexpr size_t n_trees = 120;
+inline constexpr size_t n_nodes = 5782;
+
+alignas(64) inline constexpr ForestNode nodes[] = {
+    {0x1.29bd3b1f6b3b5p+2, 10, 26, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1fedd2b8ad024p+1, 0, 28, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 32, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.29bd3b1f6b3b5p+2, 10, 36, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 42, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bffff77e19492p+4, 1, 44, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 50, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.2515a08a62ad6p+2, 10, 52, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.a2246d9835c87p+16, 8, 56, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.000faf21976d9p+26, 6, 58, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.f0bbf45a2ac61p-2, 12, 60, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.226536458c987p+17, 2, 66, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.dc0d6d9eb79ecp+16, 8, 68, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bc0169580616p+6, 5, 72, {0x0p+0, 0x0p+0}},
+    {0x1.0c8753e507706p+1, 0, 1370, {0x0p+0, 0x0p+0}},
+    {0x1.0d4c873021ed2p+5, 1, 74, {0x0p+0, 0x0p+0}},
+    {0x1.c7d35edb14f6ep+13, 2, 4464, {0x0p+0, 0x0p+0}},
+    {0x1.275a1dcada8b1p+2, 10, 76, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1ce9ab74c7654p+18, 8, 80, {0x0p+0, 0x0p+0}},
+    {0x1.b8812ea8e0f4ep+9, 3, 1048, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 82, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.d93e084d7c967p-2, 12, 84, {0x0p+0, 0x0p+0}},
+    {0x1.2a70d05ea5de9p+9, 4, 1878, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 88, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.cabcf40153d5fp+1, 11, 90, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.f1e7d8280d772p+15, 2, 96, {0x0p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 2044, {0x0p+0, 0x0p+0}},
+    {0x1.6bc93cab92e36p+17, 7, 2066, {0x0p+0, 0x0p+0}},
+    {0x1.d4651ab11af26p+5, 1, 98, {0x0p+0, 0x0p+0}},
+    {0x1.028ad1a8399cfp+26, 6, 104, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.27b7cef874d2bp+2, 10, 108, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.588f4ff3e1acfp+17, 7, 110, {0x0p+0, 0x0p+0}},
+    {0x1.98ff0009dc67fp-2, 12, 2180, {0x0p+0, 0x0p+0}},
+    {0x1.ce161869e58ffp-2, 12, 116, {0x0p+0, 0x0p+0}},
+    {0x1.6f2fd51909a48p+16, 7, 2232, {0x0p+0, 0x0p+0}},
+    {0x1.0f19a2e8433dfp+1, 0, 128, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.2e82665ea9139p+22, 6, 1734, {0x0p+0, 0x0p+0}},
+    {0x1.29bd3b1f6b3b5p+2, 10, 130, {0x0p+0, 0x0p+0}},
+    {0x1.20524c01b2587p+2, 10, 132, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.16104b81ab614p+11, 3, 134, {0x0p+0, 0x0p+0}},
+    {0x1.3099d8526a10ep+15, 2, 720, {0x0p+0, 0x0p+0}},
+    {0x1.1bfe3af10ba2ap+1, 0, 136, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bc0169580616p+6, 5, 138, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.649dbc497bddp+17, 7, 142, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b75483c1429b9p+1, 11, 748, {0x0p+0, 0x0p+0}},
+    {0x1.cdd97b3bea0d5p+1, 11, 148, {0x0p+0, 0x0p+0}},
+    {0x1.2b15120115f25p+2, 10, 154, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0cb6fe3e538f1p+18, 7, 1822, {0x0p+0, 0x0p+0}},
+    {0x1.e7e49b41ba4dp+1, 11, 156, {0x0p+0, 0x0p+0}},
+    {0x1.cd9824e5938a6p+42, 9, 1374, {0x0p+0, 0x0p+0}},
+    {0x1.28fbc42bbf11p+2, 10, 158, {0x0p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 160, {0x0p+0, 0x0p+0}},
+    {0x1.f0556468a9755p+11, 4, 1030, {0x0p+0, 0x0p+0}},
+    {0x1.226536458c987p+17, 2, 162, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.7dab796fee19bp+39, 9, 164, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c3255e6f7815bp+10, 4, 168, {0x0p+0, 0x0p+0}},
+    {0x1.c25c27fee4218p-2, 12, 3344, {0x0p+0, 0x0p+0}},
+    {0x1.21d616c165d2fp+5, 1, 3356, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 170, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 172, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c5775ebe7581dp-2, 12, 3396, {0x0p+0, 0x0p+0}},
+    {0x1.d944ed55ece24p+16, 8, 176, {0x0p+0, 0x0p+0}},
+    {0x1.fdf3a99a3331p+16, 7, 182, {0x0p+0, 0x0p+0}},
+    {0x1.b0412f453c6b5p+9, 3, 1444, {0x0p+0, 0x0p+0}},
+    {0x1.1d8fdb234502ap+2, 10, 184, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 186, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c0f2affb7a765p+1, 11, 202, {0x0p+0, 0x0p+0}},
+    {0x1.decaff2ebdbdep+1, 11, 3688, {0x0p+0, 0x0p+0}},
+    {0x1.1c63783577066p+1, 0, 208, {0x0p+0, 0x0p+0}},
+    {0x1.040e90e8c34c1p+1, 0, 2068, {0x0p+0, 0x0p+0}},
+    {0x1.58b53cc781f04p+17, 7, 216, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 220, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.24c4baa54bed1p+2, 10, 222, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c28026ab62dd5p-2, 12, 224, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.14583b06981efp+43, 9, 234, {0x0p+0, 0x0p+0}},
+    {0x1.bae05cf50ae98p-2, 12, 1620, {0x0p+0, 0x0p+0}},
+    {0x1.e52b078b0e80fp+1, 11, 236, {0x0p+0, 0x0p+0}},
+    {0x1.bc0169580616p+6, 5, 1628, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 238, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.9a01690affbb4p+6, 5, 240, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b828ed45a896bp+1, 11, 248, {0x0p+0, 0x0p+0}},
+    {0x1.1f6b45ea131f7p+1, 0, 250, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.f443bb54dad8ep+0, 0, 256, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1436f2ca7bf6p+1, 0, 258, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 262, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.d51f12c4ab4e2p+4, 1, 264, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.cc8282860d543p-2, 12, 268, {0x0p+0, 0x0p+0}},
+    {0x1.299e239e985e5p+2, 10, 1296, {0x0p+0, 0x0p+0}},
+    {0x1.330c1bfa7a8f8p+44, 9, 272, {0x0p+0, 0x0p+0}},
+    {0x1.108f8890bf3b7p+25, 6, 4236, {0x0p+0, 0x0p+0}},
+    {0x1.c4387d70bbc58p+1, 11, 274, {0x0p+0, 0x0p+0}},
+    {0x1.84429d73f804dp+41, 9, 978, {0x0p+0, 0x0p+0}},
+    {0x1.53be64dd52f01p+17, 7, 1314, {0x0p+0, 0x0p+0}},
+    {0x1.18ec6af18aea9p+2, 10, 276, {0x0p+0, 0x0p+0}},
+    {0x1.635f56ced5fffp+17, 8, 278, {0x0p+0, 0x0p+0}},
+    {0x1.9f7319102d2fap+10, 4, 1748, {0x0p+0, 0x0p+0}},
+    {0x1.16127259cf0d4p+17, 7, 1762, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 280, {0x0p+0, 0x0p+0}},
+    {0x1.cd7a2db25aad8p+16, 8, 282, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.326e269fb9c8dp+2, 10, 288, {0x0p+0, 0x0p+0}},
+    {0x1.cabcf40153d5fp+1, 11, 1340, {0x0p+0, 0x0p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 290, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1451e9707f40bp+5, 1, 292, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.066d96bbf5dbp+17, 8, 296, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ed2f6938b4f1ap-2, 12, 298, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.29d1448ea0f7dp+2, 10, 300, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 302, {0x0p+0, 0x0p+0}},
+    {0x1.08b92121b7c24p+1, 0, 1816, {0x0p+0, 0x0p+0}},
+    {0x1.275cd7dc71786p+15, 2, 304, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.093cd0e4e3b09p-1, 12, 306, {0x0p+0, 0x0p+0}},
+    {0x1.a3cd6d58bd72p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f3c7d828b69bcp+15, 2, 308, {0x0p+0, 0x0p+0}},
+    {0x1.97602dec9a07ap+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 312, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.96016901efecdp+6, 5, 316, {0x0p+0, 0x0p+0}},
+    {0x1.bcb981464451dp+1, 11, 320, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.f1895cf2c5139p+0, 0, 322, {0x0p+0, 0x0p+0}},
+    {0x1.98e99fb9df5a3p+43, 9, 1872, {0x0p+0, 0x0p+0}},
+    {0x1.99873b6a96919p+4, 1, 2510, {0x0p+0, 0x0p+0}},
+    {0x1.226536458c987p+17, 2, 324, {0x0p+0, 0x0p+0}},
+    {0x1.d6016992ecd3ep+6, 5, 326, {0x0p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 2516, {0x0p+0, 0x0p+0}},
+    {0x1.c22701ebddefp+1, 11, 328, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.4a168ff1c14e5p+2, 10, 332, {0x0p+0, 0x0p+0}},
+    {0x1.e64263baa1337p-2, 12, 1072, {0x0p+0, 0x0p+0}},
+    {0x1.db456d3fed224p+16, 8, 334, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.189435c9e76ddp+17, 2, 336, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.d957ade3432d8p+16, 8, 1922, {0x0p+0, 0x0p+0}},
+    {0x1.1436f2ca7bf6p+1, 0, 338, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 342, {0x0p+0, 0x0p+0}},
+    {0x1.96e2fcf72c1b2p+41, 9, 1096, {0x0p+0, 0x0p+0}},
+    {0x1.0585ec0e35d4ep+16, 2, 346, {0x0p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 3490, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 352, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.70c9744b090a6p+17, 7, 356, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.17d8456ca9c4dp+1, 0, 360, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.108e732cc7d1p+1, 0, 364, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.10963a21a9691p+1, 0, 366, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.649dbc497bddp+17, 7, 374, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.000faf21976d9p+26, 6, 376, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.d0e04b8169d04p+11, 3, 378, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.96016901efecdp+6, 5, 380, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.36af6ece67444p+44, 9, 382, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c90eed69c4f3ap+16, 8, 386, {0x0p+0, 0x0p+0}},
+    {0x1.d93f8e9849e5fp-1, 12, 3730, {0x0p+0, 0x0p+0}},
+    {0x1.81ee91b2d2136p+41, 9, 388, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1d92fa7837567p+2, 10, 390, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.54a376cf37ed6p+17, 8, 396, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.e50f03a39855cp+1, 11, 398, {0x0p+0, 0x0p+0}},
+    {0x1.ebbfe3e85b83dp+0, 0, 1186, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 400, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bd75a15c01255p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1bfe3af10ba2ap+1, 0, 402, {0x0p+0, 0x0p+0}},
+    {0x1.c4f506922fec2p+1, 11, 404, {0x0p+0, 0x0p+0}},
+    {0x1.7c9e2da8d253dp+16, 8, 2126, {0x0p+0, 0x0p+0}},
+    {0x1.04b7344d9e257p+1, 0, 3844, {0x0p+0, 0x0p+0}},
+    {0x1.108e732cc7d1p+1, 0, 406, {0x0p+0, 0x0p+0}},
+    {0x1.0d98053ec082bp+1, 0, 408, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.27b7cef874d2bp+2, 10, 410, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1bfe3af10ba2ap+1, 0, 414, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.dd1a2d99a4669p+16, 8, 416, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.697a255ce1412p+42, 9, 422, {0x0p+0, 0x0p+0}},
+    {0x1.02871d01e33p+1, 0, 2898, {0x0p+0, 0x0p+0}},
+    {0x1.5a325b371bd25p+15, 8, 426, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.03209765cf2a6p+10, 3, 428, {0x0p+0, 0x0p+0}},
+    {0x1.b0412f453c6b5p+9, 3, 2186, {0x0p+0, 0x0p+0}},
+    {0x1.200ec0e3355c2p+18, 7, 5446, {0x0p+0, 0x0p+0}},
+    {0x1.1fedd2b8ad024p+1, 0, 430, {0x0p+0, 0x0p+0}},
+    {0x1.ca4c5ac957a94p-2, 12, 434, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.d944ed55ece24p+16, 8, 438, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0f4f34ee93a6cp+1, 0, 442, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.06d7609695f25p+18, 7, 444, {0x0p+0, 0x0p+0}},
+    {0x1.ea2384dc83162p+40, 9, 1668, {0x0p+0, 0x0p+0}},
+    {0x1.cd482d9aa80e6p+16, 8, 446, {0x0p+0, 0x0p+0}},
+    {0x1.b11e84b8a9a0fp+10, 4, 2244, {0x0p+0, 0x0p+0}},
+    {0x1.c7786fca78d7ap-2, 12, 450, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1f469d93f9b0bp+2, 10, 456, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 4150, {0x0p+0, 0x0p+0}},
+    {0x1.48ec9a247aa22p+17, 7, 458, {0x0p+0, 0x0p+0}},
+    {0x1.0e3aed2bf787fp+5, 1, 460, {0x0p+0, 0x0p+0}},
+    {0x1.725d2d74be7d6p+16, 8, 1704, {0x0p+0, 0x0p+0}},
+    {0x1.299e239e985e5p+2, 10, 462, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.128f446fb5457p+2, 10, 4182, {0x0p+0, 0x0p+0}},
+    {0x1.68acd8252b5d6p+15, 2, 464, {0x0p+0, 0x0p+0}},
+    {0x1.6bea522e6f2edp+17, 7, 3068, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 466, {0x0p+0, 0x0p+0}},
+    {0x1.cabcf40153d5fp+1, 11, 468, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0aa447ff7674fp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b828ed45a896bp+1, 11, 470, {0x0p+0, 0x0p+0}},
+    {0x1.bde3676657001p+1, 11, 472, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.b828ed45a896bp+1, 11, 476, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6de09744be6f9p+10, 3, 478, {0x0p+0, 0x0p+0}},
+    {0x1.df2016fb3d05p+24, 6, 4246, {0x0p+0, 0x0p+0}},
+    {0x1.d36c86762800cp-2, 12, 480, {0x0p+0, 0x0p+0}},
+    {0x1.11da871e0e746p+7, 1, 2342, {0x0p+0, 0x0p+0}},
+    {0x1.da561e7ee1db4p+39, 9, 482, {0x0p+0, 0x0p+0}},
+    {0x1.0901f6222f293p+17, 2, 986, {0x0p+0, 0x0p+0}},
+    {0x1.e1304b867aa9cp+11, 3, 486, {0x0p+0, 0x0p+0}},
+    {0x1.51f20dd0b3573p+17, 7, 2366, {0x0p+0, 0x0p+0}},
+    {0x1.1e398ff9d792fp+1, 0, 730, {0x0p+0, 0x0p+0}},
+    {0x1.01212b4cefd8cp+26, 6, 488, {0x0p+0, 0x0p+0}},
+    {0x1.2c225ac8950cp+45, 9, 490, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1b8a8ec7c8fdep+1, 0, 492, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.e52b078b0e80fp+1, 11, 494, {0x0p+0, 0x0p+0}},
+    {0x1.bdbb26dad6e42p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c2e97ac5aaec9p-2, 12, 2388, {0x0p+0, 0x0p+0}},
+    {0x1.5d02d815dd09bp+15, 2, 496, {0x0p+0, 0x0p+0}},
+    {0x1.c7f4effefb00ep-2, 12, 1008, {0x0p+0, 0x0p+0}},
+    {0x1.28adc32a64841p+2, 10, 498, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 500, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.370a500f2bb3bp+17, 7, 4408, {0x0p+0, 0x0p+0}},
+    {0x1.19560b714725bp+18, 8, 504, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 506, {0x0p+0, 0x0p+0}},
+    {0x1.044b832e0057ap+24, 6, 1804, {0x0p+0, 0x0p+0}},
+    {0x1.8afb87fbf126bp+5, 1, 508, {0x0p+0, 0x0p+0}},
+    {0x1.7a07adfc2d85fp+16, 8, 2424, {0x0p+0, 0x0p+0}},
+    {0x1.ba30b05a4163ap+4, 1, 510, {0x0p+0, 0x0p+0}},
+    {0x1.426d5e1d08e8ep+9, 4, 2432, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c00c15ff79cc5p+0, 11, 512, {0x0p+0, 0x0p+0}},
+    {0x1.dfba0418ff8bcp-2, 12, 514, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a6aae095ff2fdp+1, 11, 516, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1260adabf91dap+1, 0, 518, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.b6a43cb677f19p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.842fad9ff4bd5p+16, 8, 522, {0x0p+0, 0x0p+0}},
+    {0x1.db456d3fed224p+16, 8, 524, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.08d26c1571773p+2, 1, 526, {0x0p+0, 0x0p+0}},
+    {0x1.cc9421a8513cp-2, 12, 528, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.6c0b03553ef28p+17, 7, 530, {0x0p+0, 0x0p+0}},
+    {0x1.2a535e2fb6ea2p+9, 4, 1406, {0x0p+0, 0x0p+0}},
+    {0x1.3974b0286a29ep+42, 9, 4332, {0x0p+0, 0x0p+0}},
+    {0x1.0f269e4705182p+5, 1, 532, {0x0p+0, 0x0p+0}},
+    {0x1.2561b8eb9cceep+41, 9, 534, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.033ec0165d03ap+1, 0, 1414, {0x0p+0, 0x0p+0}},
+    {0x1.f067d3beb7ba1p+10, 4, 536, {0x0p+0, 0x0p+0}},
+    {0x1.ca4c5ac957a94p-2, 12, 538, {0x0p+0, 0x0p+0}},
+    {0x1.c5268cc4cc55ap+2, 10, 1064, {0x0p+0, 0x0p+0}},
+    {0x1.58b53cc781f04p+17, 7, 540, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1205f75d92ce1p+11, 4, 542, {0x0p+0, 0x0p+0}},
+    {0x1.2900b4986c6fbp+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c72d0947b0d69p-2, 12, 544, {0x0p+0, 0x0p+0}},
+    {0x1.ac767eff457f8p+1, 11, 546, {0x0p+0, 0x0p+0}},
+    {0x1.a664d223388bap+1, 11, 548, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.58e25927c1b38p+43, 9, 554, {0x0p+0, 0x0p+0}},
+    {0x1.b68de59dfd4cbp+17, 7, 4698, {0x0p+0, 0x0p+0}},
+    {0x1.0f0bcf10c1c4p+1, 0, 558, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b9a70bbf95683p+44, 9, 560, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 564, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.dd972d92a94cap+16, 8, 566, {0x0p+0, 0x0p+0}},
+    {0x1.56db3b83e2053p+11, 4, 1948, {0x0p+0, 0x0p+0}},
+    {0x1.1bfe3af10ba2ap+1, 0, 568, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0f144600c3b7cp+1, 0, 570, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.cc873861612cep-2, 12, 572, {0x0p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 2620, {0x0p+0, 0x0p+0}},
+    {0x1.1fedd2b8ad024p+1, 0, 578, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.e38bb1948d8f8p+1, 11, 584, {0x0p+0, 0x0p+0}},
+    {0x1.bc1a3bc4d7faep+1, 11, 1492, {0x0p+0, 0x0p+0}},
+    {0x1.10963a21a9691p+1, 0, 586, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 588, {0x0p+0, 0x0p+0}},
+    {0x1.8aa1ae17bab2ep+16, 8, 3598, {0x0p+0, 0x0p+0}},
+    {0x1.bcb8dfbcc0d56p+4, 1, 590, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.9bed58666360bp+10, 4, 592, {0x0p+0, 0x0p+0}},
+    {0x1.24b5bc5c9dbb1p+2, 10, 1136, {0x0p+0, 0x0p+0}},
+    {0x1.b3d35af9f5865p+1, 11, 594, {0x0p+0, 0x0p+0}},
+    {0x1.e62e889ddd3acp-2, 12, 1510, {0x0p+0, 0x0p+0}},
+    {0x1.11a3edec8446ap+1, 0, 596, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 598, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0f416117122ccp+1, 0, 600, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.dc4b04e3773bbp-2, 12, 602, {0x0p+0, 0x0p+0}},
+    {0x1.ae147fff4b292p+1, 11, 1148, {0x0p+0, 0x0p+0}},
+    {0x1.2c116b764c957p+42, 9, 604, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0512509cf7c57p-1, 12, 606, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b6a43cb677f19p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.226862cafa004p+10, 4, 608, {0x0p+0, 0x0p+0}},
+    {0x1.b305f5524ea2ap+1, 11, 610, {0x0p+0, 0x0p+0}},
+    {0x1.0b63717b6296ep+2, 10, 5086, {0x0p+0, 0x0p+0}},
+    {0x1.c7786fca78d7ap-2, 12, 612, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0ba803f13c846p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e8e0971f74644p+10, 3, 614, {0x0p+0, 0x0p+0}},
+    {0x1.c10dcf831ddfbp+1, 11, 2072, {0x0p+0, 0x0p+0}},
+    {0x1.1ebea6cb59aa1p+2, 10, 616, {0x0p+0, 0x0p+0}},
+    {0x1.e1304b867aa9cp+11, 3, 870, {0x0p+0, 0x0p+0}},
+    {0x1.fe55512d36f1dp+0, 0, 620, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 622, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.1176a32e0d955p+1, 0, 624, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.417f2c89b6e6fp+2, 10, 626, {0x0p+0, 0x0p+0}},
+    {0x1.c584a83dcc565p+1, 11, 2104, {0x0p+0, 0x0p+0}},
+    {0x1.a3f4f0231a1e1p+23, 6, 628, {0x0p+0, 0x0p+0}},
+    {0x1.a7812dca68e2ap+9, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.222a6996996ffp+1, 0, 630, {0x0p+0, 0x0p+0}},
+    {0x1.7acb6bb0be286p+26, 6, 2114, {0x0p+0, 0x0p+0}},
+    {0x1.b5104b1c12c2fp+11, 3, 632, {0x0p+0, 0x0p+0}},
+    {0x1.2c6f9fde916cbp+2, 10, 2828, {0x0p+0, 0x0p+0}},
+    {0x1.ae704b89ebec9p+11, 3, 636, {0x0p+0, 0x0p+0}},
+    {0x1.44b34954a9302p+6, 1, 2840, {0x0p+0, 0x0p+0}},
+    {0x1.b8c81f6deb7b9p+1, 11, 638, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 2130, {0x0p+0, 0x0p+0}},
+    {0x1.f315c134f432ep+0, 0, 640, {0x0p+0, 0x0p+0}},
+    {0x1.decaff2ebdbdep+1, 11, 1200, {0x0p+0, 0x0p+0}},
+    {0x1.d6016992ecd3ep+6, 5, 642, {0x0p+0, 0x0p+0}},
+    {0x1.08b92121b7c24p+1, 0, 2138, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 644, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.50a04b78df6d4p+11, 3, 646, {0x0p+0, 0x0p+0}},
+    {0x1.206012624c286p+26, 6, 2872, {0x0p+0, 0x0p+0}},
+    {0x1.44958377fd859p+2, 10, 1606, {0x0p+0, 0x0p+0}},
+    {0x1.27b7cef874d2bp+2, 10, 648, {0x0p+0, 0x0p+0}},
+    {0x1.29d1448ea0f7dp+2, 10, 650, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.cd482d9aa80e6p+16, 8, 652, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.88b2d0d7fa55cp+17, 7, 654, {0x0p+0, 0x0p+0}},
+    {0x1.f28388a2d6959p+0, 0, 2170, {0x0p+0, 0x0p+0}},
+    {0x1.71c4c21df9fc7p+17, 7, 656, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0dee298a59abdp-1, 12, 658, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2d97adaded7bbp+2, 10, 660, {0x0p+0, 0x0p+0}},
+    {0x1.dbc2d4d7f056dp+1, 11, 662, {0x0p+0, 0x0p+0}},
+    {0x1.3444cc45b8dbfp+1, 0, 5448, {0x0p+0, 0x0p+0}},
+    {0x1.ca3d1841fc9fbp-2, 12, 666, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.4e67d3b7819ecp+10, 4, 3986, {0x0p+0, 0x0p+0}},
+    {0x1.cd7a2db25aad8p+16, 8, 668, {0x0p+0, 0x0p+0}},
+    {0x1.0a23f94438a9ep+1, 0, 670, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.e52b078b0e80fp+1, 11, 1248, {0x0p+0, 0x0p+0}},
+    {0x1.90e83b1774519p+44, 9, 672, {0x0p+0, 0x0p+0}},
+    {0x1.1334f580623fdp+5, 1, 674, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.22804b86db318p+11, 3, 676, {0x0p+0, 0x0p+0}},
+    {0x1.19402d6a8686ap+9, 5, 930, {0x0p+0, 0x0p+0}},
+    {0x1.a4016921a73f6p+6, 5, 678, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e0169140f89bp+6, 5, 1264, {0x0p+0, 0x0p+0}},
+    {0x1.103abda4203f4p+5, 1, 680, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 682, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.f300b4f846cb9p+7, 5, 1682, {0x0p+0, 0x0p+0}},
+    {0x1.35f52aabe9fd2p+44, 9, 684, {0x0p+0, 0x0p+0}},
+    {0x1.c768982c00f53p-2, 12, 686, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c7786fca78d7ap-2, 12, 694, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 696, {0x0p+0, 0x0p+0}},
+    {0x1.0898a7df0ff47p+1, 0, 2286, {0x0p+0, 0x0p+0}},
+    {0x1.e8a6caa8f20c2p-2, 12, 1700, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 698, {0x0p+0, 0x0p+0}},
+    {0x1.b1e6a1bf7063cp+1, 11, 3048, {0x0p+0, 0x0p+0}},
+    {0x1.3f42e003bce23p+2, 10, 700, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 702, {0x0p+0, 0x0p+0}},
+    {0x1.725d2d74be7d6p+16, 8, 3054, {0x0p+0, 0x0p+0}},
+    {0x1.1b2ad2e87486ap+10, 4, 1712, {0x0p+0, 0x0p+0}},
+    {0x1.2a618f18c28f9p+2, 10, 704, {0x0p+0, 0x0p+0}},
+    {0x1.a19aed570a92ep+16, 8, 706, {0x0p+0, 0x0p+0}},
+    {0x1.e02c8c672b733p+1, 11, 2308, {0x0p+0, 0x0p+0}},
+    {0x1.2515a08a62ad6p+2, 10, 708, {0x0p+0, 0x0p+0}},
+    {0x1.c7f15eed4179bp+39, 9, 2312, {0x0p+0, 0x0p+0}},
+    {0x1.06d7609695f25p+18, 7, 710, {0x0p+0, 0x0p+0}},
+    {0x1.51005a2ebbbdep+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 712, {0x0p+0, 0x0p+0}},
+    {0x1.7acb6bb0be286p+26, 6, 970, {0x0p+0, 0x0p+0}},
+    {0x1.bcb981464451dp+1, 11, 714, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.dbb04b7b80376p+11, 3, 716, {0x0p+0, 0x0p+0}},
+    {0x1.ba7b7c9ac7c92p+5, 1, 4240, {0x0p+0, 0x0p+0}},
+    {0x1.5e00b49f4e35ap+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e021897bcd409p+4, 1, 718, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.11006127ae62ep+42, 9, 722, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4a206139bd957p+17, 7, 724, {0x0p+0, 0x0p+0}},
+    {0x1.0f269e4705182p+5, 1, 726, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0b4393cc4ef5bp-1, 12, 728, {0x0p+0, 0x0p+0}},
+    {0x1.bc8cb890571aap-2, 12, 3146, {0x0p+0, 0x0p+0}},
+    {0x1.c3ceb035691e7p-2, 12, 732, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c28026ab62dd5p-2, 12, 734, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cdaed8f4b8fccp-2, 12, 736, {0x0p+0, 0x0p+0}},
+    {0x1.1a005a3bf31d3p+8, 5, 3174, {0x0p+0, 0x0p+0}},
+    {0x1.5895b13ee97bbp+14, 2, 738, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24bed7f4e668cp+15, 2, 2390, {0x0p+0, 0x0p+0}},
+    {0x1.21c12a8245c98p+1, 0, 740, {0x0p+0, 0x0p+0}},
+    {0x1.e7214887f7fb7p+1, 11, 742, {0x0p+0, 0x0p+0}},
+    {0x1.e66c8e7996f2fp+23, 6, 1786, {0x0p+0, 0x0p+0}},
+    {0x1.695b12cc33abbp+1, 0, 3214, {0x0p+0, 0x0p+0}},
+    {0x1.1c6774e418422p+1, 0, 744, {0x0p+0, 0x0p+0}},
+    {0x1.57f89377fec7fp+17, 7, 746, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.2c1964a97491dp+2, 10, 750, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.09f8aaa5b15acp+23, 6, 4416, {0x0p+0, 0x0p+0}},
+    {0x1.c7786fca78d7ap-2, 12, 752, {0x0p+0, 0x0p+0}},
+    {0x1.b173c22d4fd83p+1, 11, 754, {0x0p+0, 0x0p+0}},
+    {0x1.e7c8975a4421dp+1, 11, 1810, {0x0p+0, 0x0p+0}},
+    {0x1.192e7bfd813eep+2, 10, 3252, {0x0p+0, 0x0p+0}},
+    {0x1.4c78a3588538p+1, 11, 756, {0x0p+0, 0x0p+0}},
+    {0x1.03c39b1e6b65ep+2, 10, 4454, {0x0p+0, 0x0p+0}},
+    {0x1.3c53d7ec37b61p+15, 2, 758, {0x0p+0, 0x0p+0}},
+    {0x1.b9f832a90e60dp+1, 11, 3272, {0x0p+0, 0x0p+0}},
+    {0x1.ba0f8e2dc37aep+5, 1, 760, {0x0p+0, 0x0p+0}},
+    {0x1.ba3032251142cp+0, 11, 762, {0x0p+0, 0x0p+0}},
+    {0x1.3700b4a6e9ab8p+7, 5, 3276, {0x0p+0, 0x0p+0}},
+    {0x1.b359fa944905cp+1, 11, 764, {0x0p+0, 0x0p+0}},
+    {0x1.279151ce0983bp+2, 10, 1034, {0x0p+0, 0x0p+0}},
+    {0x1.230289a981a06p+2, 10, 766, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.8a20d8503d3e3p+15, 2, 2468, {0x0p+0, 0x0p+0}},
+    {0x1.c3f9b122c419ap-2, 12, 768, {0x0p+0, 0x0p+0}},
+    {0x1.f2fd2dff2d5e9p+16, 7, 1044, {0x0p+0, 0x0p+0}},
+    {0x1.ce138f1db962ep+1, 11, 770, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6afe9bc775a67p+17, 7, 772, {0x0p+0, 0x0p+0}},
+    {0x1.0aa447ff7674fp+1, 0, 1860, {0x0p+0, 0x0p+0}},
+    {0x1.b1872d83782aap+1, 11, 774, {0x0p+0, 0x0p+0}},
+    {0x1.a4b4b3e73fbcbp+23, 6, 776, {0x0p+0, 0x0p+0}},
+    {0x1.74f7736626cf1p+24, 6, 2494, {0x0p+0, 0x0p+0}},
+    {0x1.fa3f0e1746d8p+4, 1, 2502, {0x0p+0, 0x0p+0}},
+    {0x1.3b470a02f9846p+1, 0, 778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c868b74f0004dp+25, 6, 780, {0x0p+0, 0x0p+0}},
+    {0x1.007f4613c2869p+1, 0, 782, {0x0p+0, 0x0p+0}},
+    {0x1.217fc834075fcp+4, 1, 3368, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ed61a0973354ep-2, 12, 784, {0x0p+0, 0x0p+0}},
+    {0x1.0a6ce08a243d4p+10, 4, 786, {0x0p+0, 0x0p+0}},
+    {0x1.9356e6ad4d292p+1, 11, 788, {0x0p+0, 0x0p+0}},
+    {0x1.0b4393cc4ef5bp-1, 12, 790, {0x0p+0, 0x0p+0}},
+    {0x1.65e04b84855a5p+11, 3, 4638, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2fd0bb8ec4289p+2, 10, 792, {0x0p+0, 0x0p+0}},
+    {0x1.b3fd90a288a96p+41, 9, 794, {0x0p+0, 0x0p+0}},
+    {0x1.8315b09ad8cc8p+43, 9, 1904, {0x0p+0, 0x0p+0}},
+    {0x1.54ded6dacda06p+17, 8, 796, {0x0p+0, 0x0p+0}},
+    {0x1.cdf3a1863c2c8p+1, 11, 1910, {0x0p+0, 0x0p+0}},
+    {0x1.2b35547e1c35bp+2, 10, 798, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bcb981464451dp+1, 11, 800, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.954522e11b0f2p+17, 7, 802, {0x0p+0, 0x0p+0}},
+    {0x1.e379a7c542f6cp+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bcb981464451dp+1, 11, 804, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.0f269e4705182p+5, 1, 1092, {0x0p+0, 0x0p+0}},
+    {0x1.21a90515f4f42p+26, 6, 806, {0x0p+0, 0x0p+0}},
+    {0x1.f318482e714adp+1, 11, 808, {0x0p+0, 0x0p+0}},
+    {0x1.f1fd82feb77b5p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.58b53cc781f04p+17, 7, 810, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.43e4a89a6b505p+9, 4, 2594, {0x0p+0, 0x0p+0}},
+    {0x1.e02c8c672b733p+1, 11, 812, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 1466, {0x0p+0, 0x0p+0}},
+    {0x1.e1823c8b972a8p+0, 0, 814, {0x0p+0, 0x0p+0}},
+    {0x1.aa55f0306645cp+1, 11, 816, {0x0p+0, 0x0p+0}},
+    {0x1.342b6196177a9p+1, 0, 2606, {0x0p+0, 0x0p+0}},
+    {0x1.4b1cb77313cffp+17, 7, 818, {0x0p+0, 0x0p+0}},
+    {0x1.ce1cc4304b241p+1, 11, 1108, {0x0p+0, 0x0p+0}},
+    {0x1.ce439833f13e3p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.da19bd84c4c3bp+1, 11, 820, {0x0p+0, 0x0p+0}},
+    {0x1.00ff4a3ce54dfp+1, 0, 822, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 824, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.aa80330f16eafp+1, 11, 826, {0x0p+0, 0x0p+0}},
+    {0x1.3366f6724f6aap+17, 2, 2646, {0x0p+0, 0x0p+0}},
+    {0x1.29bd3b1f6b3b5p+2, 10, 828, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.bd2bff3a1f147p+1, 11, 830, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 832, {0x0p+0, 0x0p+0}},
+    {0x1.5601698494719p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.de7fba77236aep+24, 6, 834, {0x0p+0, 0x0p+0}},
+    {0x1.94f52c9c8cfebp-2, 12, 836, {0x0p+0, 0x0p+0}},
+    {0x1.f802d398a470ep+5, 5, 4928, {0x0p+0, 0x0p+0}},
+    {0x1.f00139fba6764p-2, 12, 838, {0x0p+0, 0x0p+0}},
+    {0x1.e6d1ad8c8d076p+16, 8, 2004, {0x0p+0, 0x0p+0}},
+    {0x1.18ae406cb11a5p+1, 0, 840, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 842, {0x0p+0, 0x0p+0}},
+    {0x1.a2ab6903e2549p+1, 11, 2692, {0x0p+0, 0x0p+0}},
+    {0x1.c07aca40d086bp+10, 4, 844, {0x0p+0, 0x0p+0}},
+    {0x1.bcf0222648379p-2, 12, 3624, {0x0p+0, 0x0p+0}},
+    {0x1.e06c2d9f27092p+16, 8, 846, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 2018, {0x0p+0, 0x0p+0}},
+    {0x1.bd75a15c01255p-2, 12, 3644, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 848, {0x0p+0, 0x0p+0}},
+    {0x1.edcbcf16c1f59p-2, 12, 850, {0x0p+0, 0x0p+0}},
+    {0x1.36546d33331bdp+16, 8, 1520, {0x0p+0, 0x0p+0}},
+    {0x1.cee6cf311254fp+1, 11, 2728, {0x0p+0, 0x0p+0}},
+    {0x1.1a91f9a0e4b8ap+40, 9, 852, {0x0p+0, 0x0p+0}},
+    {0x1.54bf96cbfdfcfp+17, 8, 1152, {0x0p+0, 0x0p+0}},
+    {0x1.02e658f3509e1p+1, 0, 854, {0x0p+0, 0x0p+0}},
+    {0x1.3b17b21036d63p+23, 6, 856, {0x0p+0, 0x0p+0}},
+    {0x1.663f5dd2171e3p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.842fad9ff4bd5p+16, 8, 1536, {0x0p+0, 0x0p+0}},
+    {0x1.e5f79b87d03dap-2, 12, 858, {0x0p+0, 0x0p+0}},
+    {0x1.2a98be00945f5p+1, 11, 860, {0x0p+0, 0x0p+0}},
+    {0x1.71bd23ffe9812p+9, 4, 1540, {0x0p+0, 0x0p+0}},
+    {0x1.33e451624decdp+24, 6, 2058, {0x0p+0, 0x0p+0}},
+    {0x1.1334f580623fdp+5, 1, 862, {0x0p+0, 0x0p+0}},
+    {0x1.8a6916d051a26p+17, 8, 5126, {0x0p+0, 0x0p+0}},
+    {0x1.b601694a6e606p+6, 5, 864, {0x0p+0, 0x0p+0}},
+    {0x1.594bf94364d54p+17, 7, 866, {0x0p+0, 0x0p+0}},
+    {0x1.78392da56c959p+16, 8, 1168, {0x0p+0, 0x0p+0}},
+    {0x1.11a3edec8446ap+1, 0, 868, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.169757a33d549p+26, 6, 872, {0x0p+0, 0x0p+0}},
+    {0x1.633bc687b4f1ap+1, 0, 3768, {0x0p+0, 0x0p+0}},
+    {0x1.447571e6722fdp+24, 6, 874, {0x0p+0, 0x0p+0}},
+    {0x1.bc0169580616p+6, 5, 876, {0x0p+0, 0x0p+0}},
+    {0x1.ef7a78b2f2dfdp-2, 12, 1570, {0x0p+0, 0x0p+0}},
+    {0x1.8a12ebfd35f27p+16, 2, 878, {0x0p+0, 0x0p+0}},
+    {0x1.ab3dbc66178cap+4, 1, 3790, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b3a747fab715p+6, 1, 880, {0x0p+0, 0x0p+0}},
+    {0x1.cc1ff8ec3499bp-2, 12, 882, {0x0p+0, 0x0p+0}},
+    {0x1.f0556468a9755p+11, 4, 3810, {0x0p+0, 0x0p+0}},
+    {0x1.01341acf53af1p+1, 0, 884, {0x0p+0, 0x0p+0}},
+    {0x1.f97f167eec334p+24, 6, 2118, {0x0p+0, 0x0p+0}},
+    {0x1.b97dd048d9bb5p+1, 11, 886, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.38d693e9d685ap+40, 9, 888, {0x0p+0, 0x0p+0}},
+    {0x1.a028d80d6f8e2p+15, 2, 3834, {0x0p+0, 0x0p+0}},
+    {0x1.7b345c5f6a2c1p+15, 8, 890, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0a4627d64d25ap+2, 10, 2850, {0x0p+0, 0x0p+0}},
+    {0x1.b828ed45a896bp+1, 11, 892, {0x0p+0, 0x0p+0}},
+    {0x1.6284bf9443624p+17, 7, 2140, {0x0p+0, 0x0p+0}},
+    {0x1.0089a5c6c0945p+1, 0, 894, {0x0p+0, 0x0p+0}},
+    {0x1.17197eaf5d3b8p+1, 11, 1206, {0x0p+0, 0x0p+0}},
+    {0x1.eabfc040445eep-2, 12, 896, {0x0p+0, 0x0p+0}},
+    {0x1.e8f2f3c82bba1p+1, 11, 1210, {0x0p+0, 0x0p+0}},
+    {0x1.61dbca829c9eep+25, 6, 898, {0x0p+0, 0x0p+0}},
+    {0x1.cc8282860d543p-2, 12, 900, {0x0p+0, 0x0p+0}},
+    {0x1.0522e004d474dp+6, 1, 3898, {0x0p+0, 0x0p+0}},
+    {0x1.22804b86db318p+11, 3, 902, {0x0p+0, 0x0p+0}},
+    {0x1.351c8939b66a2p+0, 11, 1610, {0x0p+0, 0x0p+0}},
+    {0x1.2b005a1d8defap+8, 5, 904, {0x0p+0, 0x0p+0}},
+    {0x1.226536458c987p+17, 2, 906, {0x0p+0, 0x0p+0}},
+    {0x1.03209765cf2a6p+10, 3, 908, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2abc125793944p+2, 10, 910, {0x0p+0, 0x0p+0}},
+    {0x1.ec8de8c511337p+25, 6, 1226, {0x0p+0, 0x0p+0}},
+    {0x1.f9bec902d9b71p+0, 0, 912, {0x0p+0, 0x0p+0}},
+    {0x1.df1bdb23f9d01p+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 914, {0x0p+0, 0x0p+0}},
+    {0x1.becb7fbb3faebp-2, 12, 2922, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 916, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ac767eff457f8p+1, 11, 918, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.eb40dddc446eap-2, 12, 920, {0x0p+0, 0x0p+0}},
+    {0x1.1690d840caa12p+15, 2, 1240, {0x0p+0, 0x0p+0}},
+    {0x1.000faf21976d9p+26, 6, 922, {0x0p+0, 0x0p+0}},
+    {0x1.e19b9399065c1p-2, 12, 1648, {0x0p+0, 0x0p+0}},
+    {0x1.e743ca1249f3p-2, 12, 924, {0x0p+0, 0x0p+0}},
+    {0x1.2201d2439f15ep+2, 10, 926, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c801697335816p+6, 5, 1658, {0x0p+0, 0x0p+0}},
+    {0x1.29bd3b1f6b3b5p+2, 10, 928, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 2226, {0x0p+0, 0x0p+0}},
+    {0x1.db053476444eap+24, 6, 932, {0x0p+0, 0x0p+0}},
+    {0x1.597853a0b98ebp+42, 9, 5540, {0x0p+0, 0x0p+0}},
+    {0x1.b11481929818dp+41, 9, 934, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 4050, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 938, {0x0p+0, 0x0p+0}},
+    {0x1.6d21c9c9df645p+1, 11, 5578, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 940, {0x0p+0, 0x0p+0}},
+    {0x1.09e779023d6f8p+1, 0, 942, {0x0p+0, 0x0p+0}},
+    {0x1.b713555f25959p+25, 6, 5590, {0x0p+0, 0x0p+0}},
+    {0x1.7897e40d8a548p+17, 7, 4080, {0x0p+0, 0x0p+0}},
+    {0x1.b2fa8b27c8b6fp+1, 11, 944, {0x0p+0, 0x0p+0}},
+    {0x1.1444d0b90648bp+5, 1, 946, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.c7786fca78d7ap-2, 12, 948, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.18ae406cb11a5p+1, 0, 950, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.376716d34a465p+17, 8, 5670, {0x0p+0, 0x0p+0}},
+    {0x1.487e49f6eeedbp+17, 7, 952, {0x0p+0, 0x0p+0}},
+    {0x1.6d045a0a9e2bap+1, 11, 5684, {0x0p+0, 0x0p+0}},
+    {0x1.0754d16b65af4p+2, 10, 954, {0x0p+0, 0x0p+0}},
+    {0x1.b001693cd6aabp+6, 5, 956, {0x0p+0, 0x0p+0}},
+    {0x1.29797d364474ap+10, 4, 5700, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 958, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dd79ffc51812ap+0, 0, 3056, {0x0p+0, 0x0p+0}},
+    {0x1.036824dcc7d89p+1, 0, 960, {0x0p+0, 0x0p+0}},
+    {0x1.2d00b49042276p+7, 5, 962, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dcbc608da77a2p+41, 9, 964, {0x0p+0, 0x0p+0}},
+    {0x1.bcb8dfbcc0d56p+4, 1, 966, {0x0p+0, 0x0p+0}},
+    {0x1.cd44faf0f7b68p-2, 12, 4198, {0x0p+0, 0x0p+0}},
+    {0x1.5d13bf45d5a5bp+23, 6, 968, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c0eea3e32c6a8p-2, 12, 3086, {0x0p+0, 0x0p+0}},
+    {0x1.dec3046bde222p+43, 9, 972, {0x0p+0, 0x0p+0}},
+    {0x1.66907a80dca81p+1, 11, 974, {0x0p+0, 0x0p+0}},
+    {0x1.0522bc4aa180ap+28, 6, 1304, {0x0p+0, 0x0p+0}},
+    {0x1.0c619d2e2851p+1, 11, 976, {0x0p+0, 0x0p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2c404b817104fp+11, 3, 3110, {0x0p+0, 0x0p+0}},
+    {0x1.f8497bfcf29a2p+0, 0, 980, {0x0p+0, 0x0p+0}},
+    {0x1.c10dcf831ddfbp+1, 11, 4258, {0x0p+0, 0x0p+0}},
+    {0x1.fcad73fca1154p+10, 4, 982, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1a805a3d1517p+8, 5, 984, {0x0p+0, 0x0p+0}},
+    {0x1.138140d0d91aap+13, 4, 988, {0x0p+0, 0x0p+0}},
+    {0x1.c4387d70bbc58p+1, 11, 990, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 1326, {0x0p+0, 0x0p+0}},
+    {0x1.aceeed890184fp+16, 8, 992, {0x0p+0, 0x0p+0}},
+    {0x1.ed765aa5f2409p+15, 8, 994, {0x0p+0, 0x0p+0}},
+    {0x1.7e004b7d080bdp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e4a04bb88bf9bp+11, 3, 996, {0x0p+0, 0x0p+0}},
+    {0x1.16c9a0943387cp+2, 0, 3154, {0x0p+0, 0x0p+0}},
+    {0x1.be0b68d9673d8p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.14a3237a47655p+2, 10, 998, {0x0p+0, 0x0p+0}},
+    {0x1.e63ba7f76020dp+1, 11, 4316, {0x0p+0, 0x0p+0}},
+    {0x1.e64d996710b59p-2, 12, 1000, {0x0p+0, 0x0p+0}},
+    {0x1.0aa447ff7674fp+1, 0, 3176, {0x0p+0, 0x0p+0}},
+    {0x1.6c0b03553ef28p+17, 7, 1002, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0dee298a59abdp-1, 12, 1004, {0x0p+0, 0x0p+0}},
+    {0x1.e6689cfbeb8bfp-2, 12, 1006, {0x0p+0, 0x0p+0}},
+    {0x1.ae4cbd03c53fep+10, 4, 3198, {0x0p+0, 0x0p+0}},
+    {0x1.17d82ae21148p+2, 10, 1010, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 1012, {0x0p+0, 0x0p+0}},
+    {0x1.15f32fd9d9a7cp+2, 10, 1350, {0x0p+0, 0x0p+0}},
+    {0x1.c16ca8bc736d1p+1, 11, 1354, {0x0p+0, 0x0p+0}},
+    {0x1.e8db6cfa0b9fp+0, 0, 1014, {0x0p+0, 0x0p+0}},
+    {0x1.8f722f8a645cp+11, 4, 1016, {0x0p+0, 0x0p+0}},
+    {0x1.2049afe5a31f8p+14, 2, 2412, {0x0p+0, 0x0p+0}},
+    {0x1.b99e950a784f1p+24, 6, 1018, {0x0p+0, 0x0p+0}},
+    {0x1.8e00b49d4864cp+7, 5, 4252, {0x0p+0, 0x0p+0}},
+    {0x1.0898a7df0ff47p+1, 0, 3236, {0x0p+0, 0x0p+0}},
+    {0x1.a55e04d948dc9p+1, 11, 1020, {0x0p+0, 0x0p+0}},
+    {0x1.277a01a09ad5cp+1, 11, 1022, {0x0p+0, 0x0p+0}},
+    {0x1.14404b85e842fp+11, 3, 4426, {0x0p+0, 0x0p+0}},
+    {0x1.f70c794a07a0fp-2, 12, 1024, {0x0p+0, 0x0p+0}},
+    {0x1.8e0168efd04ffp+6, 5, 1366, {0x0p+0, 0x0p+0}},
+    {0x1.a1159c793051dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.513957461a3f3p+17, 7, 1026, {0x0p+0, 0x0p+0}},
+    {0x1.a6b04b8a29da2p+11, 3, 1028, {0x0p+0, 0x0p+0}},
+    {0x1.e375ce55b7839p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ef3d8c6a869e8p-2, 12, 4478, {0x0p+0, 0x0p+0}},
+    {0x1.b6104b3d7df53p+11, 3, 1032, {0x0p+0, 0x0p+0}},
+    {0x1.50e9b19f37bep+14, 2, 1036, {0x0p+0, 0x0p+0}},
+    {0x1.10b3685d0e74ep+1, 0, 2454, {0x0p+0, 0x0p+0}},
+    {0x1.0e3aed2bf787fp+5, 1, 1038, {0x0p+0, 0x0p+0}},
+    {0x1.0098102a5cd54p+23, 6, 1040, {0x0p+0, 0x0p+0}},
+    {0x1.94911b2feb1d4p+25, 6, 4512, {0x0p+0, 0x0p+0}},
+    {0x1.244d871b831b5p+10, 4, 1042, {0x0p+0, 0x0p+0}},
+    {0x1.2684177b71fc3p+2, 10, 1046, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0089a5c6c0945p+1, 0, 1050, {0x0p+0, 0x0p+0}},
+    {0x1.22010ea1c76ecp+2, 10, 1856, {0x0p+0, 0x0p+0}},
+    {0x1.166ef84c85effp+1, 0, 1052, {0x0p+0, 0x0p+0}},
+    {0x1.20800465e8b0bp+18, 7, 1054, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e88096e7b768fp+10, 3, 1056, {0x0p+0, 0x0p+0}},
+    {0x1.8afb87fbf126bp+5, 1, 1058, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.093cd0e4e3b09p-1, 12, 1060, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d9fe791f2f2eap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.03e237aad8f53p+2, 10, 1062, {0x0p+0, 0x0p+0}},
+    {0x1.97e956becb78p+17, 8, 1066, {0x0p+0, 0x0p+0}},
+    {0x1.1061450d7408p+5, 1, 3376, {0x0p+0, 0x0p+0}},
+    {0x1.2975665f5de47p+2, 10, 1422, {0x0p+0, 0x0p+0}},
+    {0x1.e572493a99dcdp+1, 11, 1068, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 1890, {0x0p+0, 0x0p+0}},
+    {0x1.57805a3d756d5p+8, 5, 1070, {0x0p+0, 0x0p+0}},
+    {0x1.56d3d82e6aebep+15, 2, 1074, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.38d693e9d685ap+40, 9, 1076, {0x0p+0, 0x0p+0}},
+    {0x1.6d0ab654db2aap+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.fe89fa32161a2p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2263f3c287a69p+1, 0, 1078, {0x0p+0, 0x0p+0}},
+    {0x1.75b242ae0ff8bp+12, 4, 1080, {0x0p+0, 0x0p+0}},
+    {0x1.5066e21da8f68p+24, 6, 2550, {0x0p+0, 0x0p+0}},
+    {0x1.0f269e4705182p+5, 1, 1082, {0x0p+0, 0x0p+0}},
+    {0x1.a2b0a2dae264bp+39, 9, 3424, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 1084, {0x0p+0, 0x0p+0}},
+    {0x1.3015ac208f6d5p+9, 4, 1440, {0x0p+0, 0x0p+0}},
+    {0x1.4081d7a03cf37p+15, 2, 1086, {0x0p+0, 0x0p+0}},
+    {0x1.05cd58121232ep+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1088, {0x0p+0, 0x0p+0}},
+    {0x1.7acb6bb0be286p+26, 6, 1090, {0x0p+0, 0x0p+0}},
+    {0x1.230289a981a06p+2, 10, 1094, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ec209735a7369p+10, 3, 1098, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bf65dbc9cf53ap+23, 6, 1100, {0x0p+0, 0x0p+0}},
+    {0x1.c4387d70bbc58p+1, 11, 1460, {0x0p+0, 0x0p+0}},
+    {0x1.650ff1c10a4fp+17, 7, 1102, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.10f1106d20dcdp+5, 1, 1104, {0x0p+0, 0x0p+0}},
+    {0x1.6284bf9443624p+17, 7, 1106, {0x0p+0, 0x0p+0}},
+    {0x1.b58b70988a1dcp+5, 1, 1954, {0x0p+0, 0x0p+0}},
+    {0x1.9d4636cca43a8p+9, 4, 1472, {0x0p+0, 0x0p+0}},
+    {0x1.c685aa81d4f87p+24, 6, 1110, {0x0p+0, 0x0p+0}},
+    {0x1.a881d80c59854p+15, 2, 1112, {0x0p+0, 0x0p+0}},
+    {0x1.7a10aac36c93ep+16, 7, 3514, {0x0p+0, 0x0p+0}},
+    {0x1.d27f68a38e60cp-2, 12, 1114, {0x0p+0, 0x0p+0}},
+    {0x1.1bfe3af10ba2ap+1, 0, 1116, {0x0p+0, 0x0p+0}},
+    {0x1.16bdbe9671d01p+24, 6, 3536, {0x0p+0, 0x0p+0}},
+    {0x1.2236ee49dcd99p+5, 1, 1118, {0x0p+0, 0x0p+0}},
+    {0x1.04d29202c9aeap+1, 0, 1120, {0x0p+0, 0x0p+0}},
+    {0x1.b58b70988a1dcp+5, 1, 1978, {0x0p+0, 0x0p+0}},
+    {0x1.0df7241a37559p+5, 1, 1122, {0x0p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 3560, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 1124, {0x0p+0, 0x0p+0}},
+    {0x1.e1b1e9b226bbfp+1, 11, 1988, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.007f4613c2869p+1, 0, 1126, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1128, {0x0p+0, 0x0p+0}},
+    {0x1.cb69c4240c1aap+1, 11, 4914, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4fd2a4e4d3cbcp+16, 7, 1130, {0x0p+0, 0x0p+0}},
+    {0x1.be09c70e8d45cp+1, 11, 1132, {0x0p+0, 0x0p+0}},
+    {0x1.093cd0e4e3b09p-1, 12, 2000, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 1134, {0x0p+0, 0x0p+0}},
+    {0x1.9f250db55fd47p+1, 11, 3606, {0x0p+0, 0x0p+0}},
+    {0x1.6e0168a751dc6p+6, 5, 4958, {0x0p+0, 0x0p+0}},
+    {0x1.a74096d374032p+10, 3, 1138, {0x0p+0, 0x0p+0}},
+    {0x1.1102c579dd8d4p+16, 7, 1140, {0x0p+0, 0x0p+0}},
+    {0x1.c652f6957b663p-2, 12, 2700, {0x0p+0, 0x0p+0}},
+    {0x1.5895b13ee97bbp+14, 2, 2020, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 1142, {0x0p+0, 0x0p+0}},
+    {0x1.0e3e10eff532p+1, 0, 1144, {0x0p+0, 0x0p+0}},
+    {0x1.977bde68b0362p+40, 9, 1516, {0x0p+0, 0x0p+0}},
+    {0x1.f461535c37c48p+0, 0, 1146, {0x0p+0, 0x0p+0}},
+    {0x1.f4fbbb0c74f51p+0, 0, 5010, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1f094ffa061ecp+1, 0, 1150, {0x0p+0, 0x0p+0}},
+    {0x1.15f20333027d9p+43, 9, 1530, {0x0p+0, 0x0p+0}},
+    {0x1.7516f9ab0ce42p+13, 4, 1154, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.94025dd45597p+17, 7, 1156, {0x0p+0, 0x0p+0}},
+    {0x1.70c9744b090a6p+17, 7, 1158, {0x0p+0, 0x0p+0}},
+    {0x1.d0e04b8169d04p+11, 3, 3696, {0x0p+0, 0x0p+0}},
+    {0x1.351c8939b66a2p+0, 11, 2052, {0x0p+0, 0x0p+0}},
+    {0x1.e7904ba04bfa9p+11, 3, 1160, {0x0p+0, 0x0p+0}},
+    {0x1.746a2d64ab652p+16, 8, 1162, {0x0p+0, 0x0p+0}},
+    {0x1.d386d2f372757p+1, 11, 1164, {0x0p+0, 0x0p+0}},
+    {0x1.05decea02db55p+5, 1, 5130, {0x0p+0, 0x0p+0}},
+    {0x1.eddefc6108a59p-2, 12, 1166, {0x0p+0, 0x0p+0}},
+    {0x1.b64e5ee108855p+1, 11, 2074, {0x0p+0, 0x0p+0}},
+    {0x1.ce83d561f7401p-2, 12, 1170, {0x0p+0, 0x0p+0}},
+    {0x1.0e3aed2bf787fp+5, 1, 1172, {0x0p+0, 0x0p+0}},
+    {0x1.41953d344414cp+26, 6, 1554, {0x0p+0, 0x0p+0}},
+    {0x1.b277bec6e37b6p+1, 11, 1174, {0x0p+0, 0x0p+0}},
+    {0x1.57d96c022f0ddp+17, 7, 5166, {0x0p+0, 0x0p+0}},
+    {0x1.2049afe5a31f8p+14, 2, 1176, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03e7496a8c981p-1, 12, 1178, {0x0p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 1180, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 2096, {0x0p+0, 0x0p+0}},
+    {0x1.00b16b7120911p+2, 10, 1182, {0x0p+0, 0x0p+0}},
+    {0x1.bcb8dfbcc0d56p+4, 1, 1184, {0x0p+0, 0x0p+0}},
+    {0x1.254db6392441ap+17, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.4196b90b7254p+2, 10, 1188, {0x0p+0, 0x0p+0}},
+    {0x1.4dd3f63b41894p+7, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 1190, {0x0p+0, 0x0p+0}},
+    {0x1.f25696112690ap-2, 12, 5248, {0x0p+0, 0x0p+0}},
+    {0x1.e4c205fcab75ep+1, 11, 1192, {0x0p+0, 0x0p+0}},
+    {0x1.240d1bcd7fcafp+2, 10, 1194, {0x0p+0, 0x0p+0}},
+    {0x1.ac52ae05a04bp+16, 8, 2122, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.940168fd68059p+6, 5, 1196, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6b47dbea05cf4p+24, 6, 1198, {0x0p+0, 0x0p+0}},
+    {0x1.c751bf2c4c1b7p+5, 1, 1202, {0x0p+0, 0x0p+0}},
+    {0x1.51005a2ebbbdep+8, 5, 5296, {0x0p+0, 0x0p+0}},
+    {0x1.4d20017def689p+12, 4, 2862, {0x0p+0, 0x0p+0}},
+    {0x1.44b34954a9302p+6, 1, 1204, {0x0p+0, 0x0p+0}},
+    {0x1.0059ad3a08719p+16, 8, 1208, {0x0p+0, 0x0p+0}},
+    {0x1.065431f3517bep+2, 10, 3876, {0x0p+0, 0x0p+0}},
+    {0x1.4da238a7e204dp+17, 7, 1212, {0x0p+0, 0x0p+0}},
+    {0x1.0b6e72e2bfd6fp+12, 4, 5336, {0x0p+0, 0x0p+0}},
+    {0x1.2e00b492861bp+7, 5, 3900, {0x0p+0, 0x0p+0}},
+    {0x1.fe22d829d5d1p+15, 2, 1214, {0x0p+0, 0x0p+0}},
+    {0x1.decffed09ddbfp-2, 12, 1216, {0x0p+0, 0x0p+0}},
+    {0x1.46c4f116e5f82p+17, 7, 1218, {0x0p+0, 0x0p+0}},
+    {0x1.11cbdf4208942p+1, 0, 1220, {0x0p+0, 0x0p+0}},
+    {0x1.2d7f225c86833p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.aa80330f16eafp+1, 11, 1222, {0x0p+0, 0x0p+0}},
+    {0x1.2f1e3af257695p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cbea2d793904p+16, 8, 1224, {0x0p+0, 0x0p+0}},
+    {0x1.102ddf404018p+2, 10, 1228, {0x0p+0, 0x0p+0}},
+    {0x1.13456e2cc5186p+16, 8, 2906, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 1230, {0x0p+0, 0x0p+0}},
+    {0x1.248e76a9907e4p+24, 6, 2924, {0x0p+0, 0x0p+0}},
+    {0x1.1c7a324facb75p+1, 11, 1232, {0x0p+0, 0x0p+0}},
+    {0x1.355ed84361c38p+15, 2, 3966, {0x0p+0, 0x0p+0}},
+    {0x1.d5cfe40c4fd32p-2, 12, 1234, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 1236, {0x0p+0, 0x0p+0}},
+    {0x1.e02c8c672b733p+1, 11, 1636, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 1640, {0x0p+0, 0x0p+0}},
+    {0x1.e2ae9717f274p+1, 11, 1238, {0x0p+0, 0x0p+0}},
+    {0x1.d59b079fe8d39p-2, 12, 1242, {0x0p+0, 0x0p+0}},
+    {0x1.2d313dde58cdbp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.339c2f39c6cfdp+9, 4, 1244, {0x0p+0, 0x0p+0}},
+    {0x1.c600b49254f91p+7, 5, 1246, {0x0p+0, 0x0p+0}},
+    {0x1.b4016945e6792p+6, 5, 1250, {0x0p+0, 0x0p+0}},
+    {0x1.2c1fec0504122p+16, 2, 4008, {0x0p+0, 0x0p+0}},
+    {0x1.df68a7949862cp+1, 11, 1252, {0x0p+0, 0x0p+0}},
+    {0x1.8e07af4d47513p-2, 12, 1254, {0x0p+0, 0x0p+0}},
+    {0x1.0e7bd22bcb0ebp+26, 6, 1256, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.896e2d790cf93p+17, 7, 1258, {0x0p+0, 0x0p+0}},
+    {0x1.6200b4a99419bp+7, 5, 2968, {0x0p+0, 0x0p+0}},
+    {0x1.275cd7dc71786p+15, 2, 4036, {0x0p+0, 0x0p+0}},
+    {0x1.a547a30d03b9fp+44, 9, 1260, {0x0p+0, 0x0p+0}},
+    {0x1.ac767eff457f8p+1, 11, 1262, {0x0p+0, 0x0p+0}},
+    {0x0p+0, -1, 0, {0x0p+0, 0x0p+0}},
+    {0x1.412dd7c3cddf4p+15, 2, 1266, {0x0p+0, 0x0p+0}},
+    {0x1.97fff202fa52bp+46, 9, 4054, {0x0p+0, 0x0p+0}},
+    {0x1.cd9db362c8959p-2, 12, 1268, {0x0p+0, 0x0p+0}},
+    {0x1.e1b1e9b226bbfp+1, 11, 4062, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1270, {0x0p+0, 0x0p+0}},
+    {0x1.e2f73a8861358p-2, 12, 2254, {0x0p+0, 0x0p+0}},
+    {0x1.d462ed9bbbe5bp+16, 8, 1272, {0x0p+0, 0x0p+0}},
+    {0x1.f0e3028daf1dep-2, 12, 2258, {0x0p+0, 0x0p+0}},
+    {0x1.70c9744b090a6p+17, 7, 2266, {0x0p+0, 0x0p+0}},
+    {0x1.caa52d63a3493p+16, 8, 1274, {0x0p+0, 0x0p+0}},
+    {0x1.b0c80f759a2ddp-2, 12, 3016, {0x0p+0, 0x0p+0}},
+    {0x1.0f19a2e8433dfp+1, 0, 1276, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1278, {0x0p+0, 0x0p+0}},
+    {0x1.20194c947bf19p+15, 4, 2276, {0x0p+0, 0x0p+0}},
+    {0x1.c52dea610f20cp+1, 11, 2280, {0x0p+0, 0x0p+0}},
+    {0x1.14a3237a47655p+2, 10, 1280, {0x0p+0, 0x0p+0}},
+    {0x1.e4e28be8b3189p+41, 9, 3034, {0x0p+0, 0x0p+0}},
+    {0x1.e7e49b41ba4dp+1, 11, 1282, {0x0p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 3044, {0x0p+0, 0x0p+0}},
+    {0x1.ca8596ac86d7ep+17, 8, 1284, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dfe023275260cp-2, 12, 1286, {0x0p+0, 0x0p+0}},
+    {0x1.0b00b48824279p+7, 5, 1708, {0x0p+0, 0x0p+0}},
+    {0x1.03c3cb108d8b2p+2, 10, 1288, {0x0p+0, 0x0p+0}},
+    {0x1.3035faf64ac16p+10, 4, 1290, {0x0p+0, 0x0p+0}},
+    {0x1.da19bd84c4c3bp+1, 11, 3064, {0x0p+0, 0x0p+0}},
+    {0x1.88e341977c00cp+5, 1, 3072, {0x0p+0, 0x0p+0}},
+    {0x1.a5252d34fc80bp+16, 8, 1292, {0x0p+0, 0x0p+0}},
+    {0x1.ea54a7c675cf6p+0, 0, 4200, {0x0p+0, 0x0p+0}},
+    {0x1.97e096e684321p+10, 3, 1294, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f86bd826b155bp+15, 2, 1298, {0x0p+0, 0x0p+0}},
+    {0x1.0f916c1e56e6ap+16, 2, 1300, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.db456d3fed224p+16, 8, 1302, {0x0p+0, 0x0p+0}},
+    {0x1.d4efedeb9c1d4p+17, 7, 4214, {0x0p+0, 0x0p+0}},
+    {0x1.17b2f63f0b906p+17, 2, 1306, {0x0p+0, 0x0p+0}},
+    {0x1.68674adc9c3a3p+17, 7, 1728, {0x0p+0, 0x0p+0}},
+    {0x1.1c00b48c33277p+7, 5, 4242, {0x0p+0, 0x0p+0}},
+    {0x1.a225d7f729ea7p+15, 2, 1308, {0x0p+0, 0x0p+0}},
+    {0x1.c91bf8d3924e2p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0898a7df0ff47p+1, 0, 1310, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b001693cd6aabp+6, 5, 1312, {0x0p+0, 0x0p+0}},
+    {0x1.832f8fb40038p+4, 0, 1316, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3beb816f08ce4p+10, 4, 1318, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e349ff4118b85p+0, 0, 1320, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e52b078b0e80fp+1, 11, 1322, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.be1f0d8700c4p+4, 1, 1324, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2d5a859a576a4p+25, 6, 1758, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 1328, {0x0p+0, 0x0p+0}},
+    {0x1.0e1620b0b8ff6p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.5c4d9ccfefd8ap+24, 6, 1330, {0x0p+0, 0x0p+0}},
+    {0x1.be1f0d8700c4p+4, 1, 1332, {0x0p+0, 0x0p+0}},
+    {0x1.a200b496e928cp+7, 5, 4302, {0x0p+0, 0x0p+0}},
+    {0x1.c513c416bd019p+1, 11, 1334, {0x0p+0, 0x0p+0}},
+    {0x1.ebf12c1d47bb9p-2, 12, 2370, {0x0p+0, 0x0p+0}},
+    {0x1.6a339dac8fcbfp+17, 7, 1336, {0x0p+0, 0x0p+0}},
+    {0x1.b257afb461194p+1, 11, 1770, {0x0p+0, 0x0p+0}},
+    {0x1.27705e28a724p+2, 10, 1338, {0x0p+0, 0x0p+0}},
+    {0x1.974ce7aef645ep+1, 11, 1774, {0x0p+0, 0x0p+0}},
+    {0x1.8cc8d04631408p+9, 4, 1342, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d5cfe40c4fd32p-2, 12, 1344, {0x0p+0, 0x0p+0}},
+    {0x1.f11c5c05180ap+1, 11, 1782, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1c48b6babc081p+11, 4, 1346, {0x0p+0, 0x0p+0}},
+    {0x1.13701a6fd0561p-1, 12, 1348, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.13dd064977cc1p+2, 10, 1352, {0x0p+0, 0x0p+0}},
+    {0x1.9d962ca1cb557p+16, 7, 3216, {0x0p+0, 0x0p+0}},
+    {0x1.09ebf1145d4fdp+18, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c783691481733p+1, 11, 1356, {0x0p+0, 0x0p+0}},
+    {0x1.fc30c48a3a33ap+15, 7, 1358, {0x0p+0, 0x0p+0}},
+    {0x1.55d2ed1f65d4dp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f271be778791p-2, 12, 1360, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f607c1a1c3e75p+0, 0, 1806, {0x0p+0, 0x0p+0}},
+    {0x1.b0412f453c6b5p+9, 3, 1362, {0x0p+0, 0x0p+0}},
+    {0x1.eaef8a955ba56p+0, 0, 1812, {0x0p+0, 0x0p+0}},
+    {0x1.44ba921f465a1p+24, 6, 1364, {0x0p+0, 0x0p+0}},
+    {0x1.c64cf71b7019fp+10, 4, 1368, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.806ff6df6b649p+17, 8, 1372, {0x0p+0, 0x0p+0}},
+    {0x1.c0f2affb7a765p+1, 11, 1376, {0x0p+0, 0x0p+0}},
+    {0x1.1f402565cbc03p+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.75642ddb2880cp+16, 8, 1378, {0x0p+0, 0x0p+0}},
+    {0x1.2eda77aa68a0dp+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.fa5d5d39757fap+0, 0, 1380, {0x0p+0, 0x0p+0}},
+    {0x1.696d96ed0848fp+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.203f5ebaab3p+26, 6, 2456, {0x0p+0, 0x0p+0}},
+    {0x1.c7d35edb14f6ep+13, 2, 1382, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d399e6e2736d8p+4, 1, 1384, {0x0p+0, 0x0p+0}},
+    {0x1.ca016977bd689p+6, 5, 1840, {0x0p+0, 0x0p+0}},
+    {0x1.08fd6e3331ce4p-1, 12, 1386, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.93803f68e46a1p-2, 12, 1388, {0x0p+0, 0x0p+0}},
+    {0x1.142f144423d2bp+1, 0, 2470, {0x0p+0, 0x0p+0}},
+    {0x1.dd9d4f6e45d32p+1, 11, 1390, {0x0p+0, 0x0p+0}},
+    {0x1.09a92f9e4ccb3p+10, 4, 1392, {0x0p+0, 0x0p+0}},
+    {0x1.b601694a6e606p+6, 5, 1394, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1396, {0x0p+0, 0x0p+0}},
+    {0x1.f119da1d24342p+42, 9, 3308, {0x0p+0, 0x0p+0}},
+    {0x1.0bb3923e5de68p+38, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9fd24a07af6bap+46, 9, 1398, {0x0p+0, 0x0p+0}},
+    {0x1.b4104b6ddefcbp+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8098edbc1627bp+16, 8, 1400, {0x0p+0, 0x0p+0}},
+    {0x1.2344e8afa034ep+5, 1, 1402, {0x0p+0, 0x0p+0}},
+    {0x1.8a9ce396b404ap+1, 11, 3326, {0x0p+0, 0x0p+0}},
+    {0x1.94e85248eb934p+46, 9, 1404, {0x0p+0, 0x0p+0}},
+    {0x1.dda537cbe431p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.db20973d9dfc5p+10, 3, 1408, {0x0p+0, 0x0p+0}},
+    {0x1.2d97adaded7bbp+2, 10, 3338, {0x0p+0, 0x0p+0}},
+    {0x1.1f4ed8453fc4cp+15, 2, 1410, {0x0p+0, 0x0p+0}},
+    {0x1.009a181e450eap+2, 10, 1874, {0x0p+0, 0x0p+0}},
+    {0x1.ecf337207630ep-2, 12, 1412, {0x0p+0, 0x0p+0}},
+    {0x1.e564a3394200bp-1, 12, 4588, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.decaff2ebdbdep+1, 11, 1416, {0x0p+0, 0x0p+0}},
+    {0x1.2a535e2fb6ea2p+9, 4, 1418, {0x0p+0, 0x0p+0}},
+    {0x1.170e1a6c94726p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.afea7c6f07661p+41, 9, 1420, {0x0p+0, 0x0p+0}},
+    {0x1.1311f509fb15dp+2, 10, 4608, {0x0p+0, 0x0p+0}},
+    {0x1.27c7e2d4e8ab7p+2, 10, 1424, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f1d750c21cb54p+0, 0, 1426, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1003c77daa074p+2, 10, 1428, {0x0p+0, 0x0p+0}},
+    {0x1.26ad9cb3be6eep+44, 9, 1898, {0x0p+0, 0x0p+0}},
+    {0x1.e50f03a39855cp+1, 11, 1430, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.97c04b6b09c24p+11, 3, 1432, {0x0p+0, 0x0p+0}},
+    {0x1.6734219e66894p+1, 11, 1434, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.20722a2922c4ep+1, 0, 1436, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.850524f150cf1p+17, 7, 1914, {0x0p+0, 0x0p+0}},
+    {0x1.0b4393cc4ef5bp-1, 12, 1438, {0x0p+0, 0x0p+0}},
+    {0x1.eb7b16c601eacp+17, 8, 3430, {0x0p+0, 0x0p+0}},
+    {0x1.27ccfb47ae33cp+2, 10, 1442, {0x0p+0, 0x0p+0}},
+    {0x1.e25cf83fcb0dep+23, 6, 4704, {0x0p+0, 0x0p+0}},
+    {0x1.85f43bc27783bp+4, 1, 1446, {0x0p+0, 0x0p+0}},
+    {0x1.dce839b1cef18p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0f4f34ee93a6cp+1, 0, 1448, {0x0p+0, 0x0p+0}},
+    {0x1.977bde68b0362p+40, 9, 1450, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.61d4d8516e36ep+15, 2, 2574, {0x0p+0, 0x0p+0}},
+    {0x1.c0f2affb7a765p+1, 11, 1452, {0x0p+0, 0x0p+0}},
+    {0x1.14da824a40db8p+1, 0, 2576, {0x0p+0, 0x0p+0}},
+    {0x1.0098102a5cd54p+23, 6, 1454, {0x0p+0, 0x0p+0}},
+    {0x1.c5536011f6c5fp-2, 12, 2582, {0x0p+0, 0x0p+0}},
+    {0x1.ce1cc4304b241p+1, 11, 1456, {0x0p+0, 0x0p+0}},
+    {0x1.3f933f010d586p+41, 9, 2586, {0x0p+0, 0x0p+0}},
+    {0x1.1ac5958fadae5p+2, 10, 1458, {0x0p+0, 0x0p+0}},
+    {0x1.43e4a89a6b505p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.224bc258d9fdfp+1, 0, 1462, {0x0p+0, 0x0p+0}},
+    {0x1.1f5b72d7281fbp+1, 11, 1464, {0x0p+0, 0x0p+0}},
+    {0x1.b829a28a957f9p+17, 7, 1944, {0x0p+0, 0x0p+0}},
+    {0x1.97663f6c4494fp+1, 11, 4772, {0x0p+0, 0x0p+0}},
+    {0x1.aa46c57ebd8fp+1, 11, 1468, {0x0p+0, 0x0p+0}},
+    {0x1.138140d0d91aap+13, 4, 1470, {0x0p+0, 0x0p+0}},
+    {0x1.a78096f89caabp+10, 3, 1956, {0x0p+0, 0x0p+0}},
+    {0x1.64c096789cc38p+10, 3, 1474, {0x0p+0, 0x0p+0}},
+    {0x1.07c5ada3d8334p+16, 8, 4794, {0x0p+0, 0x0p+0}},
+    {0x1.954522e11b0f2p+17, 7, 1476, {0x0p+0, 0x0p+0}},
+    {0x1.2a9025aa33766p+12, 3, 4798, {0x0p+0, 0x0p+0}},
+    {0x1.ed906161ef9f9p-2, 12, 1478, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 2622, {0x0p+0, 0x0p+0}},
+    {0x1.07f92230d2128p+2, 10, 4828, {0x0p+0, 0x0p+0}},
+    {0x1.50804b74b207p+11, 3, 1480, {0x0p+0, 0x0p+0}},
+    {0x1.6d0651282fe48p+17, 7, 1482, {0x0p+0, 0x0p+0}},
+    {0x1.a8c22de27e618p+16, 8, 3524, {0x0p+0, 0x0p+0}},
+    {0x1.188a767b17b9fp+2, 10, 1974, {0x0p+0, 0x0p+0}},
+    {0x1.b97dd048d9bb5p+1, 11, 1484, {0x0p+0, 0x0p+0}},
+    {0x1.8ea4e8e9b1046p+3, 1, 1486, {0x0p+0, 0x0p+0}},
+    {0x1.123bbf44976c2p+5, 1, 1980, {0x0p+0, 0x0p+0}},
+    {0x1.cb13e0abaec2bp-2, 12, 1488, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 1984, {0x0p+0, 0x0p+0}},
+    {0x1.bc104b92c9b6bp+11, 3, 2662, {0x0p+0, 0x0p+0}},
+    {0x1.2dce9c1cd68ebp+2, 10, 1490, {0x0p+0, 0x0p+0}},
+    {0x1.4d3fdc2d2322cp+5, 1, 3582, {0x0p+0, 0x0p+0}},
+    {0x1.65c0970d3f61cp+10, 3, 1494, {0x0p+0, 0x0p+0}},
+    {0x1.dce839b1cef18p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.cd7a2db25aad8p+16, 8, 1496, {0x0p+0, 0x0p+0}},
+    {0x1.1c160e766a6c2p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1c6fbea008d06p+1, 0, 1498, {0x0p+0, 0x0p+0}},
+    {0x1.b6104b3d7df53p+11, 3, 1500, {0x0p+0, 0x0p+0}},
+    {0x1.12dcf5de1d763p+24, 6, 2682, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e06c2d9f27092p+16, 8, 1502, {0x0p+0, 0x0p+0}},
+    {0x1.10b3685d0e74ep+1, 0, 1504, {0x0p+0, 0x0p+0}},
+    {0x1.a2b0a2dae264bp+39, 9, 1506, {0x0p+0, 0x0p+0}},
+    {0x1.92f0388198588p+16, 7, 3616, {0x0p+0, 0x0p+0}},
+    {0x1.31e389962db6ap+42, 9, 1508, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a69030aa3ebafp+1, 11, 1512, {0x0p+0, 0x0p+0}},
+    {0x1.68520eec2c292p+41, 9, 2712, {0x0p+0, 0x0p+0}},
+    {0x1.a74096d374032p+10, 3, 1514, {0x0p+0, 0x0p+0}},
+    {0x1.01341acf53af1p+1, 0, 3646, {0x0p+0, 0x0p+0}},
+    {0x1.ded7bd20f3d2dp+23, 6, 1518, {0x0p+0, 0x0p+0}},
+    {0x1.07955efc17ae8p+2, 10, 2720, {0x0p+0, 0x0p+0}},
+    {0x1.15a996d730d17p+17, 8, 1522, {0x0p+0, 0x0p+0}},
+    {0x1.b829a28a957f9p+17, 7, 1524, {0x0p+0, 0x0p+0}},
+    {0x1.f64bec6c52a6dp+16, 2, 2032, {0x0p+0, 0x0p+0}},
+    {0x1.184b98bc6c29cp+2, 10, 1526, {0x0p+0, 0x0p+0}},
+    {0x1.c1af6d8a55294p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2d97adaded7bbp+2, 10, 1528, {0x0p+0, 0x0p+0}},
+    {0x1.b025bc004c87dp+1, 11, 3672, {0x0p+0, 0x0p+0}},
+    {0x1.8aa1ae17bab2ep+16, 8, 1532, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1e270c677c70cp+10, 4, 1534, {0x0p+0, 0x0p+0}},
+    {0x1.0c0169f091723p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.31aec5c10801bp+2, 10, 1538, {0x0p+0, 0x0p+0}},
+    {0x1.f18127d5774bap+0, 11, 3698, {0x0p+0, 0x0p+0}},
+    {0x1.2f98c3cce2889p+2, 10, 1542, {0x0p+0, 0x0p+0}},
+    {0x1.f2f597ef19f4dp+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.009e917c68bp+1, 0, 2060, {0x0p+0, 0x0p+0}},
+    {0x1.0f5d0337a88f5p+27, 6, 1544, {0x0p+0, 0x0p+0}},
+    {0x1.342d0d1496b18p+2, 10, 1546, {0x0p+0, 0x0p+0}},
+    {0x1.0522bc4aa180ap+28, 6, 2760, {0x0p+0, 0x0p+0}},
+    {0x1.5a5e8482866d7p+17, 7, 1548, {0x0p+0, 0x0p+0}},
+    {0x1.1d204b71a737ep+11, 3, 5132, {0x0p+0, 0x0p+0}},
+    {0x1.0ec9a34a5c7bdp+10, 4, 3738, {0x0p+0, 0x0p+0}},
+    {0x1.41b5f0dbe50d2p+26, 6, 1550, {0x0p+0, 0x0p+0}},
+    {0x1.b1e4dec5a93abp+0, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c8ef14ee56718p+43, 9, 1552, {0x0p+0, 0x0p+0}},
+    {0x1.173676dd2c132p+17, 8, 1556, {0x0p+0, 0x0p+0}},
+    {0x1.00ff4a3ce54dfp+1, 0, 1558, {0x0p+0, 0x0p+0}},
+    {0x1.8aa8d81dbcf6dp+15, 2, 1560, {0x0p+0, 0x0p+0}},
+    {0x1.a1a4cc2caec61p+43, 9, 1562, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cf4cf797b6eafp+1, 11, 1564, {0x0p+0, 0x0p+0}},
+    {0x1.34e096941f935p+10, 3, 1566, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.556e96cc27183p+17, 8, 1568, {0x0p+0, 0x0p+0}},
+    {0x1.2c1fec0504122p+16, 2, 5180, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5eb8828df4ccap+17, 7, 1572, {0x0p+0, 0x0p+0}},
+    {0x1.350d61ef91711p+25, 6, 2812, {0x0p+0, 0x0p+0}},
+    {0x1.5243d830705f1p+15, 2, 1574, {0x0p+0, 0x0p+0}},
+    {0x1.eb7bc36a7fc66p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d801699774bb2p+6, 5, 1576, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1578, {0x0p+0, 0x0p+0}},
+    {0x1.1a904b88087c6p+11, 3, 5220, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1debcbf2bd127p+1, 11, 1580, {0x0p+0, 0x0p+0}},
+    {0x1.8ed4ae036dd2p+16, 8, 1582, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8ec1d83d9916fp+15, 2, 1584, {0x0p+0, 0x0p+0}},
+    {0x1.b01b6d7cbe303p+16, 8, 2834, {0x0p+0, 0x0p+0}},
+    {0x1.910522f506113p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.99cc0c071cabap+41, 9, 1586, {0x0p+0, 0x0p+0}},
+    {0x1.b3304b5f081e4p+11, 3, 1588, {0x0p+0, 0x0p+0}},
+    {0x1.0b6e72e2bfd6fp+12, 4, 3850, {0x0p+0, 0x0p+0}},
+    {0x1.e77e57eec9257p-2, 12, 1590, {0x0p+0, 0x0p+0}},
+    {0x1.c7f15eed4179bp+39, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bf3bbab20f28ap+5, 1, 1592, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0b4393cc4ef5bp-1, 12, 1594, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cdd8fd8803f6fp-2, 12, 1596, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 1598, {0x0p+0, 0x0p+0}},
+    {0x1.a402d5019b595p+5, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.6615432000a22p+16, 7, 1600, {0x0p+0, 0x0p+0}},
+    {0x1.b58b70988a1dcp+5, 1, 1602, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.055ca4fec3bc6p+2, 10, 5340, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1604, {0x0p+0, 0x0p+0}},
+    {0x1.697a255ce1412p+42, 9, 1608, {0x0p+0, 0x0p+0}},
+    {0x1.c90deebf2d92ep+1, 11, 5354, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ed1faef20a982p-2, 12, 1612, {0x0p+0, 0x0p+0}},
+    {0x1.dc1354abed094p-2, 12, 5364, {0x0p+0, 0x0p+0}},
+    {0x1.49112180d078ap+5, 1, 1614, {0x0p+0, 0x0p+0}},
+    {0x1.85fdf70557a4ep+17, 7, 1616, {0x0p+0, 0x0p+0}},
+    {0x1.c25c27fee4218p-2, 12, 2890, {0x0p+0, 0x0p+0}},
+    {0x1.2929171c29521p+1, 11, 1618, {0x0p+0, 0x0p+0}},
+    {0x1.bcb981464451dp+1, 11, 2892, {0x0p+0, 0x0p+0}},
+    {0x1.41504b841f8cp+11, 3, 3932, {0x0p+0, 0x0p+0}},
+    {0x1.172bc27c25b5dp+17, 7, 1622, {0x0p+0, 0x0p+0}},
+    {0x1.63e46f6390683p+24, 6, 1624, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.136096ee5e6dfp+10, 3, 1626, {0x0p+0, 0x0p+0}},
+    {0x1.c601696ead9a2p+6, 5, 2174, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1f12275590ee4p+2, 10, 1630, {0x0p+0, 0x0p+0}},
+    {0x1.03e7496a8c981p-1, 12, 1632, {0x0p+0, 0x0p+0}},
+    {0x1.78e2d83b37134p+15, 2, 2188, {0x0p+0, 0x0p+0}},
+    {0x1.30804b7bd9982p+11, 3, 3968, {0x0p+0, 0x0p+0}},
+    {0x1.b11481929818dp+41, 9, 1634, {0x0p+0, 0x0p+0}},
+    {0x1.11fcb19651692p+2, 10, 5458, {0x0p+0, 0x0p+0}},
+    {0x1.38018fabf49d6p+2, 10, 1638, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1642, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a801692ab70ddp+6, 5, 3988, {0x0p+0, 0x0p+0}},
+    {0x1.62cfed9657cp+16, 8, 1644, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.14662d5cd13edp+24, 6, 1646, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7700ad95c3828p+16, 8, 1650, {0x0p+0, 0x0p+0}},
+    {0x1.2247c5aa38c23p+1, 0, 1652, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 1654, {0x0p+0, 0x0p+0}},
+    {0x1.b3ad04a3654d2p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c8a62709a1261p-2, 12, 5502, {0x0p+0, 0x0p+0}},
+    {0x1.61dbca829c9eep+25, 6, 1656, {0x0p+0, 0x0p+0}},
+    {0x1.3f7cd7d888616p+15, 2, 1660, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 1662, {0x0p+0, 0x0p+0}},
+    {0x1.cc812dab8581ep+9, 3, 1664, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2a404b7836567p+11, 3, 1666, {0x0p+0, 0x0p+0}},
+    {0x1.1d3e0108a67c7p+4, 1, 5526, {0x0p+0, 0x0p+0}},
+    {0x1.22d528b1d0235p+2, 10, 1670, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.54d256d4e0f8ap+17, 8, 1672, {0x0p+0, 0x0p+0}},
+    {0x1.b0412f453c6b5p+9, 3, 1674, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6bea522e6f2edp+17, 7, 1676, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b3fd90a288a96p+41, 9, 1678, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c63e2291eca92p+0, 11, 1680, {0x0p+0, 0x0p+0}},
+    {0x1.1b81fb75380f7p+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a1b04b8fe500ep+11, 3, 1684, {0x0p+0, 0x0p+0}},
+    {0x1.17b6a715e5622p+1, 0, 2260, {0x0p+0, 0x0p+0}},
+    {0x1.48404b8108367p+11, 3, 1686, {0x0p+0, 0x0p+0}},
+    {0x1.647fe6949b17fp+5, 1, 2268, {0x0p+0, 0x0p+0}},
+    {0x1.2876286eb912dp+2, 10, 1688, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 1690, {0x0p+0, 0x0p+0}},
+    {0x1.725d2d74be7d6p+16, 8, 1692, {0x0p+0, 0x0p+0}},
+    {0x1.c0a469a72cc9ap-2, 12, 4120, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 1694, {0x0p+0, 0x0p+0}},
+    {0x1.f80169562278cp+6, 5, 1696, {0x0p+0, 0x0p+0}},
+    {0x1.3187f6701a7b6p+17, 2, 2282, {0x0p+0, 0x0p+0}},
+    {0x1.132b5ece035a3p+2, 10, 1698, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e8d2ebe54eb55p+16, 2, 1702, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c2e47e7e0364bp-2, 12, 1706, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 4168, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d2359265143acp+25, 6, 1710, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.acee969e7b0f5p+17, 8, 1714, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.29bd3b1f6b3b5p+2, 10, 1716, {0x0p+0, 0x0p+0}},
+    {0x1.57dfed93c60c2p+16, 8, 5760, {0x0p+0, 0x0p+0}},
+    {0x1.de95b7961a36fp-2, 12, 1718, {0x0p+0, 0x0p+0}},
+    {0x1.c4f506922fec2p+1, 11, 3080, {0x0p+0, 0x0p+0}},
+    {0x1.3015ac208f6d5p+9, 4, 1720, {0x0p+0, 0x0p+0}},
+    {0x1.9d66de7273113p+1, 11, 1722, {0x0p+0, 0x0p+0}},
+    {0x1.dd7cbbfee33eep-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.16a06c1e87cb5p+16, 2, 1724, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 2320, {0x0p+0, 0x0p+0}},
+    {0x1.5200b49f2c02p+7, 5, 1726, {0x0p+0, 0x0p+0}},
+    {0x1.b8812ea8e0f4ep+9, 3, 1730, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.db456d3fed224p+16, 8, 1732, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.acd8b6f773655p+17, 8, 1736, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.649d840477959p+17, 7, 1738, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2c86ff76cba73p+1, 11, 1740, {0x0p+0, 0x0p+0}},
+    {0x1.461d33b6a2d8fp+2, 10, 1742, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.00b16b7120911p+2, 10, 1744, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ba116d8d4617fp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.4b1ed84bd1b91p+15, 2, 1746, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.14a3237a47655p+2, 10, 1750, {0x0p+0, 0x0p+0}},
+    {0x1.42a9bf7dd709dp+17, 7, 1752, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.631dceaf0f029p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0f8cb438dfe97p+10, 4, 1754, {0x0p+0, 0x0p+0}},
+    {0x1.8d012e9b5eb11p+9, 3, 4278, {0x0p+0, 0x0p+0}},
+    {0x1.cc2c00f51d10fp-2, 12, 1756, {0x0p+0, 0x0p+0}},
+    {0x1.11680069ecb6p+17, 7, 1760, {0x0p+0, 0x0p+0}},
+    {0x1.f99a8958768efp+27, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.aa46c57ebd8fp+1, 11, 3150, {0x0p+0, 0x0p+0}},
+    {0x1.5e3ed6c55a7eap+17, 8, 1764, {0x0p+0, 0x0p+0}},
+    {0x1.9e0169140f89bp+6, 5, 3156, {0x0p+0, 0x0p+0}},
+    {0x1.00f792f7fa97p+1, 0, 1766, {0x0p+0, 0x0p+0}},
+    {0x1.711a1b6c0465dp+24, 6, 1768, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cee6cf311254fp+1, 11, 1772, {0x0p+0, 0x0p+0}},
+    {0x1.12805a2af57a2p+8, 5, 3164, {0x0p+0, 0x0p+0}},
+    {0x1.7de0978e93e38p+10, 3, 1776, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.19992865c133p+2, 10, 1778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7554000fced29p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5e3ed6c55a7eap+17, 8, 1780, {0x0p+0, 0x0p+0}},
+    {0x1.7bd00338b007dp+42, 9, 3200, {0x0p+0, 0x0p+0}},
+    {0x1.4771adcf2ed23p+16, 8, 1784, {0x0p+0, 0x0p+0}},
+    {0x1.080d4aa3fdca5p+24, 6, 1788, {0x0p+0, 0x0p+0}},
+    {0x1.7b4a17e656db5p+17, 7, 4370, {0x0p+0, 0x0p+0}},
+    {0x1.a33885177a224p+1, 11, 1790, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.30604b88c66bep+11, 3, 4384, {0x0p+0, 0x0p+0}},
+    {0x1.448a13d143c96p+0, 11, 1792, {0x0p+0, 0x0p+0}},
+    {0x1.8afb87fbf126bp+5, 1, 1794, {0x0p+0, 0x0p+0}},
+    {0x1.1176a32e0d955p+1, 0, 3218, {0x0p+0, 0x0p+0}},
+    {0x1.20afb103b2374p+1, 0, 1796, {0x0p+0, 0x0p+0}},
+    {0x1.1e016a1958933p+6, 5, 2406, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 1798, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1205f75d92ce1p+11, 4, 1800, {0x0p+0, 0x0p+0}},
+    {0x1.14c7fd3acf3c3p+43, 9, 1802, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.13cadc786b1ap+18, 7, 1808, {0x0p+0, 0x0p+0}},
+    {0x1.0f4f34ee93a6cp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.74896824f6757p+10, 4, 1814, {0x0p+0, 0x0p+0}},
+    {0x1.cfd9da9968026p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.fa5d5d39757fap+0, 0, 1818, {0x0p+0, 0x0p+0}},
+    {0x1.00cb39edd1c29p+1, 0, 1820, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8dd183488292ap+2, 10, 1824, {0x0p+0, 0x0p+0}},
+    {0x1.ce06e94386b8ep+1, 11, 1826, {0x0p+0, 0x0p+0}},
+    {0x1.1110257c89e9p+12, 3, 4458, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1828, {0x0p+0, 0x0p+0}},
+    {0x1.02279e1c045bp+43, 9, 4466, {0x0p+0, 0x0p+0}},
+    {0x1.4fb7208f03fc4p+17, 7, 1830, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.28f9addaf28d1p+16, 8, 4476, {0x0p+0, 0x0p+0}},
+    {0x1.02ade4cd4fedbp+1, 0, 1832, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.139f8b9498acap+18, 8, 1834, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c85a5baf97556p+15, 8, 1836, {0x0p+0, 0x0p+0}},
+    {0x1.422cd7c1e15dfp+15, 2, 3286, {0x0p+0, 0x0p+0}},
+    {0x1.012c638a68f82p+1, 0, 1838, {0x0p+0, 0x0p+0}},
+    {0x1.da3699d6dff8p+1, 11, 1842, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c6020a70a7a19p-2, 12, 1844, {0x0p+0, 0x0p+0}},
+    {0x1.24462bb0458ap+2, 10, 1846, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fefaead1c9d7ap+0, 0, 1848, {0x0p+0, 0x0p+0}},
+    {0x1.06ed092e7d30fp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a383716d2ccb8p+17, 7, 1850, {0x0p+0, 0x0p+0}},
+    {0x1.12c775ccc071p+11, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 1852, {0x0p+0, 0x0p+0}},
+    {0x1.dd9d4f6e45d32p+1, 11, 1854, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.024b3a83f2265p+1, 0, 1858, {0x0p+0, 0x0p+0}},
+    {0x1.ecc1427a607cp-2, 12, 1862, {0x0p+0, 0x0p+0}},
+    {0x1.bdb8c1b49570bp+0, 11, 1864, {0x0p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 1866, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.49e868d8b9785p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.220016c059d8ap+10, 5, 1868, {0x0p+0, 0x0p+0}},
+    {0x1.3d717c9552933p+1, 0, 1870, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a60169262f269p+6, 5, 1876, {0x0p+0, 0x0p+0}},
+    {0x1.a8404b525d636p+11, 3, 1880, {0x0p+0, 0x0p+0}},
+    {0x1.03df94faceec3p+4, 1, 2512, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 1882, {0x0p+0, 0x0p+0}},
+    {0x1.ed91cbb2d0f58p-2, 12, 4596, {0x0p+0, 0x0p+0}},
+    {0x1.cac8f7ab894b4p+0, 11, 1884, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.220016c059d8ap+10, 5, 1886, {0x0p+0, 0x0p+0}},
+    {0x1.260ee7b91de63p+5, 1, 4612, {0x0p+0, 0x0p+0}},
+    {0x1.47274bc160132p+10, 4, 1888, {0x0p+0, 0x0p+0}},
+    {0x1.10500783ec3a9p+2, 10, 1892, {0x0p+0, 0x0p+0}},
+    {0x1.188d24f00420fp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 1894, {0x0p+0, 0x0p+0}},
+    {0x1.77714cdf2524ap+1, 11, 3384, {0x0p+0, 0x0p+0}},
+    {0x1.23304b79d3925p+11, 3, 4622, {0x0p+0, 0x0p+0}},
+    {0x1.f118f21a2e516p-2, 12, 1896, {0x0p+0, 0x0p+0}},
+    {0x1.c1cc6a4ad7498p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.aec47756e4693p+1, 11, 1900, {0x0p+0, 0x0p+0}},
+    {0x1.28b7cb4a76f47p+24, 6, 1902, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b3c7f0cf6f9abp+1, 11, 1906, {0x0p+0, 0x0p+0}},
+    {0x1.34eaec019d56fp+16, 2, 4650, {0x0p+0, 0x0p+0}},
+    {0x1.ee3b8b0b8218p-2, 12, 1908, {0x0p+0, 0x0p+0}},
+    {0x1.2c6f9fde916cbp+2, 10, 2544, {0x0p+0, 0x0p+0}},
+    {0x1.760168b971794p+6, 5, 1912, {0x0p+0, 0x0p+0}},
+    {0x1.487100b76495fp+17, 7, 3420, {0x0p+0, 0x0p+0}},
+    {0x1.da19bd84c4c3bp+1, 11, 1916, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.220016c059d8ap+10, 5, 1918, {0x0p+0, 0x0p+0}},
+    {0x1.0718d929e38c7p+2, 10, 1920, {0x0p+0, 0x0p+0}},
+    {0x1.eebe5a3c65307p+16, 7, 3432, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2fd3f5fb19c1p+17, 2, 1924, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a74096d374032p+10, 3, 1926, {0x0p+0, 0x0p+0}},
+    {0x1.a69030aa3ebafp+1, 11, 1928, {0x0p+0, 0x0p+0}},
+    {0x1.78faedbf07166p+16, 8, 3446, {0x0p+0, 0x0p+0}},
+    {0x1.d2412f354edfdp+9, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 1930, {0x0p+0, 0x0p+0}},
+    {0x1.bdb8c1b49570bp+0, 11, 1932, {0x0p+0, 0x0p+0}},
+    {0x1.23c0976ff0dd4p+10, 3, 4720, {0x0p+0, 0x0p+0}},
+    {0x1.6d17da574e8edp+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7700ad95c3828p+16, 8, 1934, {0x0p+0, 0x0p+0}},
+    {0x1.aeaaad94a5d1fp+16, 8, 1936, {0x0p+0, 0x0p+0}},
+    {0x1.eb65d76aad4a7p-2, 12, 4732, {0x0p+0, 0x0p+0}},
+    {0x1.dbc2d4d7f056dp+1, 11, 1938, {0x0p+0, 0x0p+0}},
+    {0x1.a1dc6c30c36e6p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.12a57724a9c07p+1, 0, 1940, {0x0p+0, 0x0p+0}},
+    {0x1.9fd24a07af6bap+46, 9, 3474, {0x0p+0, 0x0p+0}},
+    {0x1.b801694ef6479p+6, 5, 1942, {0x0p+0, 0x0p+0}},
+    {0x1.a5fdab5abaa6fp-2, 12, 3476, {0x0p+0, 0x0p+0}},
+    {0x1.1c77a3278d3d3p+10, 4, 4756, {0x0p+0, 0x0p+0}},
+    {0x1.34508b5b76251p+1, 0, 1946, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c72e5b21679aap+15, 8, 1950, {0x0p+0, 0x0p+0}},
+    {0x1.ab4096e5e9602p+10, 3, 1952, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.06f0b1bdb905cp+23, 6, 1958, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.800f6d7aeaf21p+16, 8, 4796, {0x0p+0, 0x0p+0}},
+    {0x1.3f575c34e0963p+2, 1, 1960, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.159ff609d0c3p+17, 2, 1962, {0x0p+0, 0x0p+0}},
+    {0x1.db54a1b535c77p-2, 12, 1964, {0x0p+0, 0x0p+0}},
+    {0x1.1237056dd7f03p+5, 1, 4800, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 1966, {0x0p+0, 0x0p+0}},
+    {0x1.136096ee5e6dfp+10, 3, 2624, {0x0p+0, 0x0p+0}},
+    {0x1.af849078dfce1p+4, 1, 1968, {0x0p+0, 0x0p+0}},
+    {0x1.024c62d2c6c2ap+44, 9, 2630, {0x0p+0, 0x0p+0}},
+    {0x1.0cef439776a5dp+1, 0, 1970, {0x0p+0, 0x0p+0}},
+    {0x1.b20169415e91fp+6, 5, 1972, {0x0p+0, 0x0p+0}},
+    {0x1.3ff9590be992bp+1, 11, 1976, {0x0p+0, 0x0p+0}},
+    {0x1.e4b1d99800f37p-2, 12, 2642, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a36096d392f9fp+10, 3, 1982, {0x0p+0, 0x0p+0}},
+    {0x1.b4f96b00a98d2p+0, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e106c3300ba04p-2, 12, 1986, {0x0p+0, 0x0p+0}},
+    {0x1.0fd7e40a99631p+1, 11, 1990, {0x0p+0, 0x0p+0}},
+    {0x1.3c8ed8ebe1fb5p+9, 4, 3570, {0x0p+0, 0x0p+0}},
+    {0x1.27b7cef874d2bp+2, 10, 1992, {0x0p+0, 0x0p+0}},
+    {0x1.019ffdf0216f5p-1, 12, 4902, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4eb937c6ca471p+5, 1, 1994, {0x0p+0, 0x0p+0}},
+    {0x1.8cde9790c5b47p+24, 6, 1996, {0x0p+0, 0x0p+0}},
+    {0x1.a52323890e5d2p+1, 11, 2674, {0x0p+0, 0x0p+0}},
+    {0x1.0134bf9181cedp+45, 9, 1998, {0x0p+0, 0x0p+0}},
+    {0x1.4163764aaf936p+17, 2, 2676, {0x0p+0, 0x0p+0}},
+    {0x1.a4016921a73f6p+6, 5, 2002, {0x0p+0, 0x0p+0}},
+    {0x1.1cb025b5c8babp+12, 3, 4934, {0x0p+0, 0x0p+0}},
+    {0x1.fb00b4c57e0d8p+7, 5, 4952, {0x0p+0, 0x0p+0}},
+    {0x1.a5409703d50aap+10, 3, 2006, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.43005a0f046b5p+8, 5, 2008, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.991ba3df014e2p-2, 12, 2010, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0585ec0e35d4ep+16, 2, 2012, {0x0p+0, 0x0p+0}},
+    {0x1.ccf98590c1af6p+0, 11, 2014, {0x0p+0, 0x0p+0}},
+    {0x1.10bdc5d69d2cfp+2, 10, 4972, {0x0p+0, 0x0p+0}},
+    {0x1.ba3032251142cp+0, 11, 2016, {0x0p+0, 0x0p+0}},
+    {0x1.948ef1360629dp+41, 9, 4978, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.05c7f6d0cca78p+17, 8, 2022, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d54dc91f956ep+0, 0, 2024, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1dde89237121fp+2, 10, 2026, {0x0p+0, 0x0p+0}},
+    {0x1.b57aea6209e2fp+1, 11, 3652, {0x0p+0, 0x0p+0}},
+    {0x1.324435e4edddfp+17, 2, 2028, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 2724, {0x0p+0, 0x0p+0}},
+    {0x1.92d3d4c13cb96p+5, 1, 2030, {0x0p+0, 0x0p+0}},
+    {0x1.ebc9fb0b22b1fp+0, 0, 2034, {0x0p+0, 0x0p+0}},
+    {0x1.2804960359a5p+2, 10, 5028, {0x0p+0, 0x0p+0}},
+    {0x1.0dee298a59abdp-1, 12, 2036, {0x0p+0, 0x0p+0}},
+    {0x1.4d5b9afdf04c2p+5, 1, 3666, {0x0p+0, 0x0p+0}},
+    {0x1.cd7a2db25aad8p+16, 8, 2038, {0x0p+0, 0x0p+0}},
+    {0x1.907754cda4478p+4, 1, 2736, {0x0p+0, 0x0p+0}},
+    {0x1.850524f150cf1p+17, 7, 2040, {0x0p+0, 0x0p+0}},
+    {0x1.0447a15313d08p+2, 10, 3674, {0x0p+0, 0x0p+0}},
+    {0x1.5d419655c0084p+1, 0, 3680, {0x0p+0, 0x0p+0}},
+    {0x1.ed2e1cbcd3809p-2, 12, 2042, {0x0p+0, 0x0p+0}},
+    {0x1.2adf663821467p+5, 1, 2046, {0x0p+0, 0x0p+0}},
+    {0x1.7002e054e42b7p+4, 1, 5068, {0x0p+0, 0x0p+0}},
+    {0x1.1e398ff9d792fp+1, 0, 3694, {0x0p+0, 0x0p+0}},
+    {0x1.c28026ab62dd5p-2, 12, 2048, {0x0p+0, 0x0p+0}},
+    {0x1.eedd2401b5ef5p+16, 7, 2050, {0x0p+0, 0x0p+0}},
+    {0x1.7d00b4993964ep+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.548096f00d7ffp+10, 3, 3704, {0x0p+0, 0x0p+0}},
+    {0x1.a95e6dea52ebp+16, 8, 2054, {0x0p+0, 0x0p+0}},
+    {0x1.fa5d5d39757fap+0, 0, 2056, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e4ba6ffe9a3bp+0, 0, 2062, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.33a471f17652ep+1, 11, 2064, {0x0p+0, 0x0p+0}},
+    {0x1.c33ac3b0e9842p+1, 11, 5104, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.22010ea1c76ecp+2, 10, 2070, {0x0p+0, 0x0p+0}},
+    {0x1.aa328451d2249p-2, 12, 2076, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.aac4d82ae7acap+15, 2, 2078, {0x0p+0, 0x0p+0}},
+    {0x1.f723ad5fc0727p+1, 11, 3742, {0x0p+0, 0x0p+0}},
+    {0x1.299e239e985e5p+2, 10, 2080, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bcb8dfbcc0d56p+4, 1, 2082, {0x0p+0, 0x0p+0}},
+    {0x1.399f53828b9aep+24, 6, 3750, {0x0p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 3752, {0x0p+0, 0x0p+0}},
+    {0x1.024b3a83f2265p+1, 0, 2084, {0x0p+0, 0x0p+0}},
+    {0x1.691f6a16ca648p+1, 11, 2086, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.eb40dddc446eap-2, 12, 2088, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0f4f34ee93a6cp+1, 0, 2090, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4d8493986cfdcp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d1f58684cbf7p+1, 11, 2092, {0x0p+0, 0x0p+0}},
+    {0x1.d0604baa4fed2p+11, 3, 2094, {0x0p+0, 0x0p+0}},
+    {0x1.0b078fd357e2fp+44, 9, 2796, {0x0p+0, 0x0p+0}},
+    {0x1.2c61b8d7c392ap+40, 9, 2098, {0x0p+0, 0x0p+0}},
+    {0x1.e7214887f7fb7p+1, 11, 3778, {0x0p+0, 0x0p+0}},
+    {0x1.c2a00bd0ccc33p+1, 11, 2100, {0x0p+0, 0x0p+0}},
+    {0x1.df402d3fc32d7p+10, 4, 2102, {0x0p+0, 0x0p+0}},
+    {0x1.fe379067c39b9p+0, 0, 2814, {0x0p+0, 0x0p+0}},
+    {0x1.c5e5d9460e126p+1, 11, 2106, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 2108, {0x0p+0, 0x0p+0}},
+    {0x1.e26a1f4c5f76ep-2, 12, 2110, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c22025308101ap+16, 7, 2112, {0x0p+0, 0x0p+0}},
+    {0x1.dc03fb81c03e4p-2, 12, 2116, {0x0p+0, 0x0p+0}},
+    {0x1.1d20ef977da91p+2, 10, 3814, {0x0p+0, 0x0p+0}},
+    {0x1.07a2261f49b23p+2, 10, 5252, {0x0p+0, 0x0p+0}},
+    {0x1.3c5bd7dab20b8p+15, 2, 2120, {0x0p+0, 0x0p+0}},
+    {0x1.88b2d0d7fa55cp+17, 7, 2124, {0x0p+0, 0x0p+0}},
+    {0x1.e3eea76021f73p+4, 1, 3824, {0x0p+0, 0x0p+0}},
+    {0x1.0c12e464ebbbcp+10, 4, 2128, {0x0p+0, 0x0p+0}},
+    {0x1.691f6a16ca648p+1, 11, 3840, {0x0p+0, 0x0p+0}},
+    {0x1.8e35ef2dc21b3p+17, 7, 2132, {0x0p+0, 0x0p+0}},
+    {0x1.eb7b16c601eacp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8dd183488292ap+2, 10, 2134, {0x0p+0, 0x0p+0}},
+    {0x1.a186f3c1e979dp+5, 1, 3856, {0x0p+0, 0x0p+0}},
+    {0x1.11bb56da680f4p+17, 8, 2136, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f7cafc320c98cp+1, 11, 2142, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bb69e8f6a723bp+17, 7, 2144, {0x0p+0, 0x0p+0}},
+    {0x1.d957e54ae7f76p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.de20972ea8271p+10, 3, 2146, {0x0p+0, 0x0p+0}},
+    {0x1.f856658cb8bbbp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d8f9da52df108p+0, 0, 2148, {0x0p+0, 0x0p+0}},
+    {0x1.5e3256bf6dd6ep+17, 8, 2150, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f802d398a470ep+5, 5, 3890, {0x0p+0, 0x0p+0}},
+    {0x1.0898a7df0ff47p+1, 0, 2152, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 2154, {0x0p+0, 0x0p+0}},
+    {0x1.6d0ab654db2aap+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a6cbaebee8e9cp+1, 11, 2156, {0x0p+0, 0x0p+0}},
+    {0x1.79678bc67f4f1p+17, 7, 5360, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 2158, {0x0p+0, 0x0p+0}},
+    {0x1.53cd8b38212b1p+24, 6, 3906, {0x0p+0, 0x0p+0}},
+    {0x1.0d6473ce55f5ap+2, 10, 2160, {0x0p+0, 0x0p+0}},
+    {0x1.d801699774bb2p+6, 5, 2162, {0x0p+0, 0x0p+0}},
+    {0x1.b36ea5f41e2dep+17, 7, 3908, {0x0p+0, 0x0p+0}},
+    {0x1.e50f03a39855cp+1, 11, 2164, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5b5cd9b49e7ebp+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b7a01707e0cbcp+17, 8, 2166, {0x0p+0, 0x0p+0}},
+    {0x1.08b92121b7c24p+1, 0, 5394, {0x0p+0, 0x0p+0}},
+    {0x1.13456e2cc5186p+16, 8, 2168, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.05771f3417959p+24, 6, 2172, {0x0p+0, 0x0p+0}},
+    {0x1.d957e54ae7f76p+0, 0, 5410, {0x0p+0, 0x0p+0}},
+    {0x1.88204b928cffap+11, 3, 2176, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.90b1b3baa4ea7p+6, 1, 2178, {0x0p+0, 0x0p+0}},
+    {0x1.afcd19016586fp+24, 6, 3948, {0x0p+0, 0x0p+0}},
+    {0x1.948a6c0ddbe69p+16, 2, 2182, {0x0p+0, 0x0p+0}},
+    {0x1.5900b49dcd949p+7, 5, 2184, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e3a5ec3335f95p+16, 2, 2190, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.50c0968f895e8p+10, 3, 3970, {0x0p+0, 0x0p+0}},
+    {0x1.c7fc6aa4daef9p+4, 1, 2192, {0x0p+0, 0x0p+0}},
+    {0x1.2f00b494ca0eap+7, 5, 2194, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0512509cf7c57p-1, 12, 2196, {0x0p+0, 0x0p+0}},
+    {0x1.0a021e474776ap+1, 0, 3974, {0x0p+0, 0x0p+0}},
+    {0x1.b8f04b8f2b383p+11, 3, 5470, {0x0p+0, 0x0p+0}},
+    {0x1.8be6ada8dd1e2p+16, 8, 2198, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c00c15ff79cc5p+0, 11, 2200, {0x0p+0, 0x0p+0}},
+    {0x1.1205f75d92ce1p+11, 4, 3990, {0x0p+0, 0x0p+0}},
+    {0x1.70404b8ccab66p+11, 3, 2202, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c4387d70bbc58p+1, 11, 2204, {0x0p+0, 0x0p+0}},
+    {0x1.fd2d2354416b6p+0, 0, 2206, {0x0p+0, 0x0p+0}},
+    {0x1.f00139fba6764p-2, 12, 2208, {0x0p+0, 0x0p+0}},
+    {0x1.f6f1c4c5d17f5p+40, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ce1cc4304b241p+1, 11, 2210, {0x0p+0, 0x0p+0}},
+    {0x1.9900b4b633dc8p+7, 5, 2212, {0x0p+0, 0x0p+0}},
+    {0x1.11d253b638263p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.708db0b5c6d29p+17, 7, 2214, {0x0p+0, 0x0p+0}},
+    {0x1.588f4ff3e1acfp+17, 7, 2216, {0x0p+0, 0x0p+0}},
+    {0x1.fb84252b046eep-2, 12, 5506, {0x0p+0, 0x0p+0}},
+    {0x1.6e8c429730cd6p+1, 0, 2218, {0x0p+0, 0x0p+0}},
+    {0x1.e5d61c243188ap+24, 6, 2220, {0x0p+0, 0x0p+0}},
+    {0x1.22d4d81f669a6p+15, 2, 4020, {0x0p+0, 0x0p+0}},
+    {0x1.ecf337207630ep-2, 12, 2222, {0x0p+0, 0x0p+0}},
+    {0x1.2e2788f87a425p+1, 0, 2224, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c826f0f0de4e4p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.725d2d74be7d6p+16, 8, 2228, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eccbe758f0c4ap+16, 7, 2230, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.331825e478de7p+12, 3, 2234, {0x0p+0, 0x0p+0}},
+    {0x1.7560ed8784814p+4, 1, 2236, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fc30c48a3a33ap+15, 7, 2238, {0x0p+0, 0x0p+0}},
+    {0x1.d5b8e8f70ea1p+24, 6, 2240, {0x0p+0, 0x0p+0}},
+    {0x1.3b412df2f4881p+9, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e65a74021a003p-2, 12, 2242, {0x0p+0, 0x0p+0}},
+    {0x1.96c09725bc18p+10, 3, 2246, {0x0p+0, 0x0p+0}},
+    {0x1.33e36e1cc794dp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.063025ec60c41p+12, 3, 2248, {0x0p+0, 0x0p+0}},
+    {0x1.fa1f5820da85p+0, 0, 4064, {0x0p+0, 0x0p+0}},
+    {0x1.11a3edec8446ap+1, 0, 2250, {0x0p+0, 0x0p+0}},
+    {0x1.3f08bb84396c9p+2, 10, 2252, {0x0p+0, 0x0p+0}},
+    {0x1.8ffa3da830235p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.35ec7f4ed4b7dp+10, 4, 2256, {0x0p+0, 0x0p+0}},
+    {0x1.a60262c4979fp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d6a37f19fc754p-2, 12, 2262, {0x0p+0, 0x0p+0}},
+    {0x1.a4a227cb6da29p+25, 6, 2264, {0x0p+0, 0x0p+0}},
+    {0x1.569b2f070d916p+24, 6, 2270, {0x0p+0, 0x0p+0}},
+    {0x1.50de6817dc0aap+2, 10, 4096, {0x0p+0, 0x0p+0}},
+    {0x1.fcbe2d979d16ep+16, 8, 4108, {0x0p+0, 0x0p+0}},
+    {0x1.588f4ff3e1acfp+17, 7, 2272, {0x0p+0, 0x0p+0}},
+    {0x1.2737ad05aaf4fp+16, 8, 4110, {0x0p+0, 0x0p+0}},
+    {0x1.17b6da61be18dp+27, 6, 2274, {0x0p+0, 0x0p+0}},
+    {0x1.97ffde4c03372p+1, 11, 2278, {0x0p+0, 0x0p+0}},
+    {0x1.67c0975015c64p+10, 3, 4122, {0x0p+0, 0x0p+0}},
+    {0x1.a931c2b8b025fp+1, 11, 2284, {0x0p+0, 0x0p+0}},
+    {0x1.a547a30d03b9fp+44, 9, 4134, {0x0p+0, 0x0p+0}},
+    {0x1.0d805a1fa1b81p+8, 5, 3036, {0x0p+0, 0x0p+0}},
+    {0x1.01dfa4dce23ep+1, 0, 2288, {0x0p+0, 0x0p+0}},
+    {0x1.c28026ab62dd5p-2, 12, 2290, {0x0p+0, 0x0p+0}},
+    {0x1.ed2096e3dafcdp+10, 3, 2292, {0x0p+0, 0x0p+0}},
+    {0x1.d9604b7d6e6d6p+11, 3, 2294, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8c005ab464e2fp+8, 5, 4162, {0x0p+0, 0x0p+0}},
+    {0x1.21a90515f4f42p+26, 6, 2296, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.960ad1b7ec716p+17, 7, 2298, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03140c5db1c99p+2, 10, 2300, {0x0p+0, 0x0p+0}},
+    {0x1.5ee7edce308f9p+16, 8, 2302, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2d97adaded7bbp+2, 10, 2304, {0x0p+0, 0x0p+0}},
+    {0x1.2c116b764c957p+42, 9, 5740, {0x0p+0, 0x0p+0}},
+    {0x1.4cec76d6ddf67p+17, 8, 2306, {0x0p+0, 0x0p+0}},
+    {0x1.dac4e571e2d6bp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f512df75b4ee2p+10, 4, 2310, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0c619d2e2851p+1, 11, 2314, {0x0p+0, 0x0p+0}},
+    {0x1.77cd30dcc7b15p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.674a3ed46587dp+17, 7, 2316, {0x0p+0, 0x0p+0}},
+    {0x1.92e45e9515bffp+17, 7, 2318, {0x0p+0, 0x0p+0}},
+    {0x1.0504924d73b3ap+1, 0, 5774, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5fa5ab814f44bp+5, 1, 2322, {0x0p+0, 0x0p+0}},
+    {0x1.a74096d374032p+10, 3, 2324, {0x0p+0, 0x0p+0}},
+    {0x1.2b186f6de12d6p+2, 10, 3090, {0x0p+0, 0x0p+0}},
+    {0x1.084096c5d5357p+10, 3, 3096, {0x0p+0, 0x0p+0}},
+    {0x1.50c1f4fb3ddacp+24, 6, 2326, {0x0p+0, 0x0p+0}},
+    {0x1.17f118f59d938p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e0fda63c71382p+1, 11, 2328, {0x0p+0, 0x0p+0}},
+    {0x1.0cba6e2d9922cp+16, 8, 2330, {0x0p+0, 0x0p+0}},
+    {0x1.bdbd2b886b7d3p+17, 7, 2332, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e1b1e9b226bbfp+1, 11, 2334, {0x0p+0, 0x0p+0}},
+    {0x1.22d528b1d0235p+2, 10, 2336, {0x0p+0, 0x0p+0}},
+    {0x1.00624b382c32dp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.61c30ac27925ep+17, 7, 2338, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d401698e64ecbp+6, 5, 2340, {0x0p+0, 0x0p+0}},
+    {0x1.6d2356e8c81c7p+17, 8, 3114, {0x0p+0, 0x0p+0}},
+    {0x1.ba0169537e2edp+6, 5, 2344, {0x0p+0, 0x0p+0}},
+    {0x1.a87863394b223p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ae0169384ec38p+6, 5, 2346, {0x0p+0, 0x0p+0}},
+    {0x1.ad4a65cf8da99p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.52d2b8c589eb2p+17, 7, 2348, {0x0p+0, 0x0p+0}},
+    {0x1.013aada4ac3dap+16, 8, 4268, {0x0p+0, 0x0p+0}},
+    {0x1.0bc80f75c5fddp+2, 0, 2350, {0x0p+0, 0x0p+0}},
+    {0x1.13e79982d6737p+2, 10, 2352, {0x0p+0, 0x0p+0}},
+    {0x1.c230ebf5b7778p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.6f4e322f9dfd2p+41, 9, 2354, {0x0p+0, 0x0p+0}},
+    {0x1.2c404b7a3d8e3p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d2e13b78ed879p+0, 11, 2356, {0x0p+0, 0x0p+0}},
+    {0x1.4b5f09bc7c73dp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e9d7fb5927fafp-2, 12, 2358, {0x0p+0, 0x0p+0}},
+    {0x1.6988d1fa1a90ap+9, 4, 2360, {0x0p+0, 0x0p+0}},
+    {0x1.3378bf1c1213ap+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0045cfa517b2ep+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2c6f9fde916cbp+2, 10, 2362, {0x0p+0, 0x0p+0}},
+    {0x1.e07fb1578ecdcp+14, 2, 3142, {0x0p+0, 0x0p+0}},
+    {0x1.a292114694058p+1, 11, 2364, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.032c22ba60107p+2, 10, 2368, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.009a181e450eap+2, 10, 2372, {0x0p+0, 0x0p+0}},
+    {0x1.a838bbe019479p+1, 11, 2374, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03e7496a8c981p-1, 12, 2376, {0x0p+0, 0x0p+0}},
+    {0x1.b235d7777b2d4p+24, 6, 3166, {0x0p+0, 0x0p+0}},
+    {0x1.1f5b72d7281fbp+1, 11, 2378, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e91a2c00917dp-2, 12, 3178, {0x0p+0, 0x0p+0}},
+    {0x1.32904b83913e6p+11, 3, 2380, {0x0p+0, 0x0p+0}},
+    {0x1.97e642eefa339p+16, 7, 3180, {0x0p+0, 0x0p+0}},
+    {0x1.2662e6fd72d6bp+1, 11, 2382, {0x0p+0, 0x0p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 2384, {0x0p+0, 0x0p+0}},
+    {0x1.c230ebf5b7778p+16, 2, 3186, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 2386, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0bf04b7a8d5bp+11, 3, 2392, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5e120a34dd4c2p+6, 1, 2394, {0x0p+0, 0x0p+0}},
+    {0x1.ca0a8067f848bp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 2396, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f42143bfa48ap+0, 0, 2398, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 2400, {0x0p+0, 0x0p+0}},
+    {0x1.a9b26c55346eap+10, 4, 3210, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0cebd209645dap+4, 1, 2402, {0x0p+0, 0x0p+0}},
+    {0x1.16ce59781266cp+1, 11, 2404, {0x0p+0, 0x0p+0}},
+    {0x1.bf027b0768503p+0, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.780168bdf9608p+6, 5, 2408, {0x0p+0, 0x0p+0}},
+    {0x1.f6c0383e0667ep+16, 7, 4396, {0x0p+0, 0x0p+0}},
+    {0x1.422cd7c1e15dfp+15, 2, 4400, {0x0p+0, 0x0p+0}},
+    {0x1.28adc32a64841p+2, 10, 2410, {0x0p+0, 0x0p+0}},
+    {0x1.8be6ada8dd1e2p+16, 8, 2414, {0x0p+0, 0x0p+0}},
+    {0x1.16857ebaef6e3p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bdcd68d3efd1bp+1, 11, 2416, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4a135b3b6f05ep+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e5cb52f08f30dp+1, 11, 2418, {0x0p+0, 0x0p+0}},
+    {0x1.2aa158bf96712p+12, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8147ed8a94051p+16, 8, 2420, {0x0p+0, 0x0p+0}},
+    {0x1.eb38759f6974ep-2, 12, 2422, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9f00b4a15764bp+7, 5, 2426, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ec0b39837b566p+0, 11, 2428, {0x0p+0, 0x0p+0}},
+    {0x1.6999a3db59395p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c5a2e1eceae11p+10, 4, 2430, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.351c8939b66a2p+0, 11, 2434, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d6636dc7f5cd8p+16, 8, 2436, {0x0p+0, 0x0p+0}},
+    {0x1.2a09d1e7ed3d6p+41, 9, 2438, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0b5d0b2c375bap+24, 6, 2440, {0x0p+0, 0x0p+0}},
+    {0x1.d78b069c4d49cp+10, 4, 3262, {0x0p+0, 0x0p+0}},
+    {0x1.6600b4a5b8571p+7, 5, 2442, {0x0p+0, 0x0p+0}},
+    {0x1.71056d987f6eap+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.067153e5823p+5, 1, 2444, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d51f12c4ab4e2p+4, 1, 4468, {0x0p+0, 0x0p+0}},
+    {0x1.247d0957ac216p+10, 4, 2446, {0x0p+0, 0x0p+0}},
+    {0x1.e7bb198752ee1p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1bd04b7832c53p+11, 3, 2448, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.33cd36d0f74d5p+17, 8, 2450, {0x0p+0, 0x0p+0}},
+    {0x1.1595d7e77ef3dp+15, 2, 2452, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7700ad95c3828p+16, 8, 2458, {0x0p+0, 0x0p+0}},
+    {0x1.f25696112690ap-2, 12, 3288, {0x0p+0, 0x0p+0}},
+    {0x1.ecceb285f3bc8p-2, 12, 2460, {0x0p+0, 0x0p+0}},
+    {0x1.a292114694058p+1, 11, 3294, {0x0p+0, 0x0p+0}},
+    {0x1.0b09a910465c4p+1, 0, 2462, {0x0p+0, 0x0p+0}},
+    {0x1.c0f2affb7a765p+1, 11, 2464, {0x0p+0, 0x0p+0}},
+    {0x1.1529db1e17c87p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1118d6ae805ep+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a0b6875d70843p+4, 1, 2466, {0x0p+0, 0x0p+0}},
+    {0x1.01341acf53af1p+1, 0, 2472, {0x0p+0, 0x0p+0}},
+    {0x1.101fe56eae764p+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.90016a07f9a3p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e4b1d99800f37p-2, 12, 2474, {0x0p+0, 0x0p+0}},
+    {0x1.2b005a62764a9p+8, 5, 2476, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e5e42da06fe31p+16, 8, 2478, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9f63c38f5ac53p+9, 4, 2480, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.376825b229a0ep+12, 3, 2482, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e48097487977fp+10, 3, 2484, {0x0p+0, 0x0p+0}},
+    {0x1.9a3af7bc477c8p-2, 12, 2486, {0x0p+0, 0x0p+0}},
+    {0x1.cc12565d99225p-2, 12, 4538, {0x0p+0, 0x0p+0}},
+    {0x1.7171ffce6a11ap+4, 1, 2488, {0x0p+0, 0x0p+0}},
+    {0x1.3f575c34e0963p+2, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.30fc620fb2205p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7609d84498711p+15, 2, 2490, {0x0p+0, 0x0p+0}},
+    {0x1.9b1bc74a4b7e1p+5, 1, 3328, {0x0p+0, 0x0p+0}},
+    {0x1.728b070909d2dp+16, 7, 2492, {0x0p+0, 0x0p+0}},
+    {0x1.3eb0d34191bb7p+43, 9, 2496, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2e757794326dfp+24, 6, 2498, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8a75edc0c4bfep+16, 8, 2500, {0x0p+0, 0x0p+0}},
+    {0x1.1c1fcc00b633ep-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e4b1d99800f37p-2, 12, 2504, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1a00b4aa1f6dcp+7, 5, 2506, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3359ff728076dp+41, 9, 2508, {0x0p+0, 0x0p+0}},
+    {0x1.a94097164a67ap+10, 3, 2514, {0x0p+0, 0x0p+0}},
+    {0x1.384825c1007f6p+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a430124699af2p+1, 11, 2518, {0x0p+0, 0x0p+0}},
+    {0x1.2fcd8f85aa6a2p+5, 1, 3370, {0x0p+0, 0x0p+0}},
+    {0x1.0ac5fd6fb14ap+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.049d04988526fp+1, 0, 2520, {0x0p+0, 0x0p+0}},
+    {0x1.04183e9f35dd7p+6, 1, 2522, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d61972b226188p-2, 12, 3380, {0x0p+0, 0x0p+0}},
+    {0x1.538563faf17e1p+24, 6, 2524, {0x0p+0, 0x0p+0}},
+    {0x1.71e7b3652ba56p+10, 4, 4620, {0x0p+0, 0x0p+0}},
+    {0x1.b7d87e38ff845p+17, 7, 2526, {0x0p+0, 0x0p+0}},
+    {0x1.38fbe0dd7030dp+24, 6, 2528, {0x0p+0, 0x0p+0}},
+    {0x1.0a1ad40b027f4p+17, 7, 2530, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5e22b6c8946f1p+17, 8, 2532, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b81c9c5014a44p+10, 4, 2534, {0x0p+0, 0x0p+0}},
+    {0x1.30fc620fb2205p+5, 1, 2536, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2a8b947eb815ep+2, 10, 2538, {0x0p+0, 0x0p+0}},
+    {0x1.29797d364474ap+10, 4, 3398, {0x0p+0, 0x0p+0}},
+    {0x1.352e890eecd72p+5, 1, 2540, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bf239c802fb19p+24, 6, 2542, {0x0p+0, 0x0p+0}},
+    {0x1.dd9d4f6e45d32p+1, 11, 4648, {0x0p+0, 0x0p+0}},
+    {0x1.2e757794326dfp+24, 6, 2546, {0x0p+0, 0x0p+0}},
+    {0x1.23bfd1882fda4p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.055682219ddbdp+2, 10, 2548, {0x0p+0, 0x0p+0}},
+    {0x1.88610bfe91a83p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0504924d73b3ap+1, 0, 2552, {0x0p+0, 0x0p+0}},
+    {0x1.c7f15eed4179bp+39, 9, 3414, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0ecd56c211033p+17, 8, 2554, {0x0p+0, 0x0p+0}},
+    {0x1.140bb311f0a53p+10, 4, 2556, {0x0p+0, 0x0p+0}},
+    {0x1.cd0c6bc405662p-1, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f271be778791p-2, 12, 2558, {0x0p+0, 0x0p+0}},
+    {0x1.151e939a2facp+1, 0, 4676, {0x0p+0, 0x0p+0}},
+    {0x1.53434ab4f3178p+6, 1, 2560, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e6e096dc9dffcp+10, 3, 3434, {0x0p+0, 0x0p+0}},
+    {0x1.902df7b1f9505p+44, 9, 2562, {0x0p+0, 0x0p+0}},
+    {0x1.51896dad57e3ep+2, 10, 2564, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4e005a27efe31p+8, 5, 2566, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2450f91206242p+1, 11, 2568, {0x0p+0, 0x0p+0}},
+    {0x1.bf027b0768503p+0, 11, 3448, {0x0p+0, 0x0p+0}},
+    {0x1.3700b4a6e9ab8p+7, 5, 2570, {0x0p+0, 0x0p+0}},
+    {0x1.b77c1c715fa53p-2, 12, 3450, {0x0p+0, 0x0p+0}},
+    {0x1.3bd7ba6af8c2bp+12, 4, 2572, {0x0p+0, 0x0p+0}},
+    {0x1.6b98250d128d6p+0, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 2578, {0x0p+0, 0x0p+0}},
+    {0x1.1e398ff9d792fp+1, 0, 2580, {0x0p+0, 0x0p+0}},
+    {0x1.108f8890bf3b7p+25, 6, 3462, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8a00b4b6acc3dp+7, 5, 2584, {0x0p+0, 0x0p+0}},
+    {0x1.c529b71be8f31p+17, 8, 2588, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bb96de2481524p+4, 1, 2590, {0x0p+0, 0x0p+0}},
+    {0x1.5ea355fa73ca5p+0, 11, 4744, {0x0p+0, 0x0p+0}},
+    {0x1.7b8770442652ep+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ea4c38b52506ep+1, 11, 2592, {0x0p+0, 0x0p+0}},
+    {0x1.960ad1b7ec716p+17, 7, 2596, {0x0p+0, 0x0p+0}},
+    {0x1.e5c6a2f3b13ecp-2, 12, 4758, {0x0p+0, 0x0p+0}},
+    {0x1.0d3f14a32b36ap+24, 6, 2598, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.df853d94df4cep+1, 11, 2600, {0x0p+0, 0x0p+0}},
+    {0x1.6ebbec0a3d9bfp+16, 2, 4770, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.03efc8cb0d6f2p+2, 10, 2602, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.99e4d634d32abp+17, 7, 2604, {0x0p+0, 0x0p+0}},
+    {0x1.27a48551a9e7bp+12, 4, 2608, {0x0p+0, 0x0p+0}},
+    {0x1.1faa5acd407efp+2, 10, 4780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 2610, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ad016d5f16d59p+41, 9, 2612, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bd90e2676c6bcp+1, 11, 2614, {0x0p+0, 0x0p+0}},
+    {0x1.e518d82ae7365p+15, 2, 2616, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b1e4dec5a93abp+0, 0, 4802, {0x0p+0, 0x0p+0}},
+    {0x1.2b004b82dfceap+11, 3, 2618, {0x0p+0, 0x0p+0}},
+    {0x1.e514211a689a6p-2, 12, 2626, {0x0p+0, 0x0p+0}},
+    {0x1.ea24edd981767p-2, 12, 2628, {0x0p+0, 0x0p+0}},
+    {0x1.fb9f5a1db9f7ep+15, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.16f522ae051d4p+2, 10, 2632, {0x0p+0, 0x0p+0}},
+    {0x1.2c9f8ed44af79p+17, 7, 2634, {0x0p+0, 0x0p+0}},
+    {0x1.0dee298a59abdp-1, 12, 3528, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.55efde6dbcebep+5, 1, 2636, {0x0p+0, 0x0p+0}},
+    {0x1.59c716c9a02eap+17, 8, 2638, {0x0p+0, 0x0p+0}},
+    {0x1.cb490605858eap+1, 11, 2640, {0x0p+0, 0x0p+0}},
+    {0x1.b4996d8bfd3ep+16, 8, 3542, {0x0p+0, 0x0p+0}},
+    {0x1.8899ce1f7ce62p+25, 6, 2644, {0x0p+0, 0x0p+0}},
+    {0x1.190e5a37be67dp+10, 4, 2648, {0x0p+0, 0x0p+0}},
+    {0x1.df304bb6dbb13p+11, 3, 2650, {0x0p+0, 0x0p+0}},
+    {0x1.bd4096ff5dccap+10, 3, 2652, {0x0p+0, 0x0p+0}},
+    {0x1.2d8059781d826p+1, 11, 2654, {0x0p+0, 0x0p+0}},
+    {0x1.c90eed69c4f3ap+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c20057088a9dep+17, 8, 2656, {0x0p+0, 0x0p+0}},
+    {0x1.0c619d2e2851p+1, 11, 2658, {0x0p+0, 0x0p+0}},
+    {0x1.9091ec0ec4149p+10, 4, 4880, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa63ee89a6044p+1, 11, 2660, {0x0p+0, 0x0p+0}},
+    {0x1.04005a4f0488bp+8, 5, 2664, {0x0p+0, 0x0p+0}},
+    {0x1.9d012ee534251p+9, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.09a27a7b309b5p+17, 7, 2666, {0x0p+0, 0x0p+0}},
+    {0x1.a4809707927ffp+10, 3, 2668, {0x0p+0, 0x0p+0}},
+    {0x1.569b2f070d916p+24, 6, 2670, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cc700e459de0ep+41, 9, 3586, {0x0p+0, 0x0p+0}},
+    {0x1.19b3022b17888p+10, 4, 2672, {0x0p+0, 0x0p+0}},
+    {0x1.26ae18b61a5d4p+43, 9, 2678, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1bbf4c6e50ee7p+1, 0, 2680, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.044b832e0057ap+24, 6, 2684, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e7bc248cbae63p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0f4f34ee93a6cp+1, 0, 2686, {0x0p+0, 0x0p+0}},
+    {0x1.a6750eb17f1dfp+1, 11, 2688, {0x0p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 4944, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0ebb2f19098f4p+2, 10, 2690, {0x0p+0, 0x0p+0}},
+    {0x1.98b1ae081c6a3p+16, 8, 2694, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.43d5c023990b5p+1, 0, 2696, {0x0p+0, 0x0p+0}},
+    {0x1.b4104b6ddefcbp+11, 3, 2698, {0x0p+0, 0x0p+0}},
+    {0x1.93bfdbea87a9ep+10, 4, 4964, {0x0p+0, 0x0p+0}},
+    {0x1.5a69ee2fca35cp+5, 1, 4976, {0x0p+0, 0x0p+0}},
+    {0x1.b284095bf3153p+11, 4, 2702, {0x0p+0, 0x0p+0}},
+    {0x1.363902347d1fp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 2704, {0x0p+0, 0x0p+0}},
+    {0x1.299e239e985e5p+2, 10, 2706, {0x0p+0, 0x0p+0}},
+    {0x1.2049afe5a31f8p+14, 2, 2708, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.04a2cf30b2f84p-1, 12, 2710, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5bcc5f61df8p+42, 9, 2714, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.27a48551a9e7bp+12, 4, 2716, {0x0p+0, 0x0p+0}},
+    {0x1.99cc0c071cabap+41, 9, 5004, {0x0p+0, 0x0p+0}},
+    {0x1.661736947ea2bp+2, 10, 2718, {0x0p+0, 0x0p+0}},
+    {0x1.166ef84c85effp+1, 0, 2722, {0x0p+0, 0x0p+0}},
+    {0x1.41ea57a3af5e5p+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0d1d964519a72p+1, 0, 2726, {0x0p+0, 0x0p+0}},
+    {0x1.ec94d8a1d89f2p-2, 12, 5020, {0x0p+0, 0x0p+0}},
+    {0x1.5b6c899677bafp+10, 4, 2730, {0x0p+0, 0x0p+0}},
+    {0x1.3e5cc5a1af546p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f5e6764f56375p-2, 12, 2732, {0x0p+0, 0x0p+0}},
+    {0x1.6ea6d6c9350c7p+17, 8, 2734, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5a01698da44p+6, 5, 2738, {0x0p+0, 0x0p+0}},
+    {0x1.115a1c93f73fcp+17, 7, 3676, {0x0p+0, 0x0p+0}},
+    {0x1.b6104b3d7df53p+11, 3, 2740, {0x0p+0, 0x0p+0}},
+    {0x1.23450147d8d7p+4, 1, 5044, {0x0p+0, 0x0p+0}},
+    {0x1.51f20dd0b3573p+17, 7, 2742, {0x0p+0, 0x0p+0}},
+    {0x1.cc40ebd2c2ac9p+16, 2, 5054, {0x0p+0, 0x0p+0}},
+    {0x1.46faed54acf08p+16, 8, 5062, {0x0p+0, 0x0p+0}},
+    {0x1.0567997772781p+25, 6, 2744, {0x0p+0, 0x0p+0}},
+    {0x1.9998edaf0992ep+16, 8, 5070, {0x0p+0, 0x0p+0}},
+    {0x1.caa52d63a3493p+16, 8, 2746, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2886f3007dce3p+2, 10, 2748, {0x0p+0, 0x0p+0}},
+    {0x1.0ddd35d3efe82p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7602d81615634p+15, 2, 2750, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.546096dd792c3p+10, 3, 2752, {0x0p+0, 0x0p+0}},
+    {0x1.4b0a27f638772p+25, 6, 2754, {0x0p+0, 0x0p+0}},
+    {0x1.c22701ebddefp+1, 11, 3706, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.01f7ee6926df9p+1, 0, 2756, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.364097607f2cep+10, 3, 2758, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ee6733fee0acbp-2, 12, 2762, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.44429cf3bfb4fp+1, 11, 2764, {0x0p+0, 0x0p+0}},
+    {0x1.1bd04b7832c53p+11, 3, 2766, {0x0p+0, 0x0p+0}},
+    {0x1.8883d8392995ep+15, 2, 2768, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 2770, {0x0p+0, 0x0p+0}},
+    {0x1.f802d398a470ep+5, 5, 5118, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.28fbc42bbf11p+2, 10, 2772, {0x0p+0, 0x0p+0}},
+    {0x1.0e966c178092bp+16, 2, 2774, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.94812d8f8943ep+9, 3, 2776, {0x0p+0, 0x0p+0}},
+    {0x1.2b510f63debafp+2, 10, 5136, {0x0p+0, 0x0p+0}},
+    {0x1.1fda6d7b9de9fp-1, 12, 2778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.26436c1818e36p+16, 2, 2780, {0x0p+0, 0x0p+0}},
+    {0x1.4e401437ba851p+3, 1, 2782, {0x0p+0, 0x0p+0}},
+    {0x1.476bffe3a1b8cp+43, 9, 3744, {0x0p+0, 0x0p+0}},
+    {0x1.e51d08e466e9fp+23, 6, 3754, {0x0p+0, 0x0p+0}},
+    {0x1.b3ad04a3654d2p-2, 12, 2784, {0x0p+0, 0x0p+0}},
+    {0x1.6f37a81ce7078p+1, 11, 2786, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 5152, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c8ef14ee56718p+43, 9, 2788, {0x0p+0, 0x0p+0}},
+    {0x1.668bd837d5274p+15, 2, 2790, {0x0p+0, 0x0p+0}},
+    {0x1.9c1e2829242adp+42, 9, 5168, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5bae91f3935bfp+17, 7, 2792, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4e575b3e792e8p+2, 10, 2794, {0x0p+0, 0x0p+0}},
+    {0x1.128f03b9582f7p+10, 4, 2798, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b6481eefc1ab5p+1, 11, 2800, {0x0p+0, 0x0p+0}},
+    {0x1.11516c1105116p+16, 2, 3770, {0x0p+0, 0x0p+0}},
+    {0x1.8b6ec10ead44dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.74d3df96bd10fp+42, 9, 2802, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8ba82d8b3dd74p+16, 8, 2804, {0x0p+0, 0x0p+0}},
+    {0x1.0b711ff212dcdp+1, 0, 2806, {0x0p+0, 0x0p+0}},
+    {0x1.9e213571f313dp+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.798868a3afea9p+17, 7, 2808, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d5b8e8f70ea1p+24, 6, 2810, {0x0p+0, 0x0p+0}},
+    {0x1.32904b83913e6p+11, 3, 5204, {0x0p+0, 0x0p+0}},
+    {0x1.ac7bd0466f3ddp+17, 7, 2816, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.31ec8d5b42bc6p+24, 6, 2818, {0x0p+0, 0x0p+0}},
+    {0x1.ab0fd816efeap+15, 2, 3800, {0x0p+0, 0x0p+0}},
+    {0x1.24093dd0ed4cep+1, 0, 2820, {0x0p+0, 0x0p+0}},
+    {0x1.bc37d8f0ec10bp+16, 7, 5230, {0x0p+0, 0x0p+0}},
+    {0x1.2d00b49042276p+7, 5, 2822, {0x0p+0, 0x0p+0}},
+    {0x1.fdec0dcc95bd1p+3, 1, 2824, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dd00537a0c2eap+24, 6, 2826, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2073676c23024p+2, 10, 2830, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.019167beff3d9p+1, 0, 2832, {0x0p+0, 0x0p+0}},
+    {0x1.e1b1e9b226bbfp+1, 11, 2836, {0x0p+0, 0x0p+0}},
+    {0x1.309025ff7f37ep+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.fefaead1c9d7ap+0, 0, 2838, {0x0p+0, 0x0p+0}},
+    {0x1.33a682273a7ap+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d5d35f8409828p-2, 12, 3832, {0x0p+0, 0x0p+0}},
+    {0x1.cee6cf311254fp+1, 11, 2842, {0x0p+0, 0x0p+0}},
+    {0x1.df44143284012p-2, 12, 2844, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e861c8a6243a7p-2, 12, 2846, {0x0p+0, 0x0p+0}},
+    {0x1.add0b6611ff1bp+17, 2, 3846, {0x0p+0, 0x0p+0}},
+    {0x1.499a9416d3f8ep+5, 1, 2848, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7eb7ad9eabe36p+16, 8, 2852, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e9d9c07cdad44p-2, 12, 2854, {0x0p+0, 0x0p+0}},
+    {0x1.d53ad75a092abp+10, 4, 2856, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c85a5baf97556p+15, 8, 2858, {0x0p+0, 0x0p+0}},
+    {0x1.a356ad62aedfdp+16, 8, 3864, {0x0p+0, 0x0p+0}},
+    {0x1.4c3d38d700f27p+10, 4, 2860, {0x0p+0, 0x0p+0}},
+    {0x1.09a92f9e4ccb3p+10, 4, 2864, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.21b04b814e7cfp+11, 3, 2866, {0x0p+0, 0x0p+0}},
+    {0x1.e01e691fefc3fp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.213dc2bd16948p+1, 0, 3878, {0x0p+0, 0x0p+0}},
+    {0x1.8ce0d8168ae5ap+15, 2, 2868, {0x0p+0, 0x0p+0}},
+    {0x1.daccb3b658769p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a100b4a5df4bep+7, 5, 2870, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 2874, {0x0p+0, 0x0p+0}},
+    {0x1.12da9639f2fa6p+1, 0, 2876, {0x0p+0, 0x0p+0}},
+    {0x1.acab65b8a3a7ap+1, 11, 2878, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a8404b525d636p+11, 3, 2880, {0x0p+0, 0x0p+0}},
+    {0x1.22608fafd6b5cp+1, 11, 2882, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.169f93468edd3p+1, 0, 2884, {0x0p+0, 0x0p+0}},
+    {0x1.5175032432b9fp+2, 10, 5366, {0x0p+0, 0x0p+0}},
+    {0x1.e6e096dc9dffcp+10, 3, 2886, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a292114694058p+1, 11, 2888, {0x0p+0, 0x0p+0}},
+    {0x1.d6f04b6cc84fbp+11, 3, 5370, {0x0p+0, 0x0p+0}},
+    {0x1.45e4a7f37c204p+17, 7, 2894, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 2896, {0x0p+0, 0x0p+0}},
+    {0x1.97e4db2320751p+43, 9, 5380, {0x0p+0, 0x0p+0}},
+    {0x1.3fb4032ed298fp+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3262ed9b5b047p+1, 0, 2900, {0x0p+0, 0x0p+0}},
+    {0x1.90e58f06e22dep+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b9fafeb6f6d0cp+5, 1, 2902, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6284bf9443624p+17, 7, 2904, {0x0p+0, 0x0p+0}},
+    {0x1.a9e42eef45cf3p+1, 11, 3938, {0x0p+0, 0x0p+0}},
+    {0x1.e8232d65d5c23p+16, 8, 2908, {0x0p+0, 0x0p+0}},
+    {0x1.8d465c7cd0029p+42, 9, 2910, {0x0p+0, 0x0p+0}},
+    {0x1.030f3ca86ed47p+1, 0, 3940, {0x0p+0, 0x0p+0}},
+    {0x1.a838bbe019479p+1, 11, 2912, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.08b92121b7c24p+1, 0, 2914, {0x0p+0, 0x0p+0}},
+    {0x1.ac71f8284a4bcp+1, 11, 2916, {0x0p+0, 0x0p+0}},
+    {0x1.12571cbbc595p+1, 0, 5426, {0x0p+0, 0x0p+0}},
+    {0x1.2d0dd9388c936p+5, 1, 2918, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.55efde6dbcebep+5, 1, 2920, {0x0p+0, 0x0p+0}},
+    {0x1.11a3edec8446ap+1, 0, 2926, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cd804b58a2aa3p+11, 3, 2928, {0x0p+0, 0x0p+0}},
+    {0x1.8bd0611a10777p+44, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8a20d8503d3e3p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2c1964a97491dp+2, 10, 2930, {0x0p+0, 0x0p+0}},
+    {0x1.d6d72086232d6p+24, 6, 5460, {0x0p+0, 0x0p+0}},
+    {0x1.a5f2ec228ffcp+16, 2, 2932, {0x0p+0, 0x0p+0}},
+    {0x1.2400b4c0c6f1ep+7, 5, 2934, {0x0p+0, 0x0p+0}},
+    {0x1.18a04b873188fp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ef6fbc852032bp+0, 0, 2936, {0x0p+0, 0x0p+0}},
+    {0x1.234efa9f4372ap+2, 10, 2938, {0x0p+0, 0x0p+0}},
+    {0x1.ef40973945b52p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f35f9bed5b43bp-2, 12, 2940, {0x0p+0, 0x0p+0}},
+    {0x1.0075343cc813ep+10, 4, 2942, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 2944, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.010956ef3f54p+18, 7, 2946, {0x0p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 3996, {0x0p+0, 0x0p+0}},
+    {0x1.1500b49ecbabbp+7, 5, 2948, {0x0p+0, 0x0p+0}},
+    {0x1.62675d2477b93p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.109d44ea00e6ap+1, 0, 2950, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0ea1f531b5e97p+1, 0, 2952, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.49ba44454555bp+2, 10, 2954, {0x0p+0, 0x0p+0}},
+    {0x1.d54815b2c7badp+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1be747d333f59p+25, 6, 2956, {0x0p+0, 0x0p+0}},
+    {0x1.ede2c81ee7d11p-2, 12, 4012, {0x0p+0, 0x0p+0}},
+    {0x1.9931047f00d43p+1, 11, 2958, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.df6097020494ep+10, 3, 2960, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.00a732a72a0ccp+1, 0, 2962, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.26f7ba8763b05p+16, 7, 2964, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e4a60215354abp+1, 11, 2966, {0x0p+0, 0x0p+0}},
+    {0x1.443b5683593b1p+41, 9, 5532, {0x0p+0, 0x0p+0}},
+    {0x1.230289a981a06p+2, 10, 2970, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b2c04b913865p+11, 3, 2972, {0x0p+0, 0x0p+0}},
+    {0x1.00f38702aa798p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e403d82979f4dp+15, 2, 2974, {0x0p+0, 0x0p+0}},
+    {0x1.58e4ebf655edap+16, 2, 2976, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4c0df6f7a9d71p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a46096f4fe2c3p+10, 3, 2978, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.461d718542633p+1, 11, 2980, {0x0p+0, 0x0p+0}},
+    {0x1.08995f3d39609p+11, 4, 2982, {0x0p+0, 0x0p+0}},
+    {0x1.e58999e28c6fbp-2, 12, 5550, {0x0p+0, 0x0p+0}},
+    {0x1.ad27d23a03e77p-2, 12, 4042, {0x0p+0, 0x0p+0}},
+    {0x1.e4c205fcab75ep+1, 11, 2984, {0x0p+0, 0x0p+0}},
+    {0x1.24c02d3fab9d3p+9, 5, 2986, {0x0p+0, 0x0p+0}},
+    {0x1.c5a23bf86fce2p+1, 11, 5564, {0x0p+0, 0x0p+0}},
+    {0x1.2561b8eb9cceep+41, 9, 2988, {0x0p+0, 0x0p+0}},
+    {0x1.27a01d4ba4023p+5, 1, 4056, {0x0p+0, 0x0p+0}},
+    {0x1.adc19c012ff33p+24, 6, 2990, {0x0p+0, 0x0p+0}},
+    {0x1.7a5a83c9883dbp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e7bb198752ee1p-2, 12, 2992, {0x0p+0, 0x0p+0}},
+    {0x1.43eee56c160acp+42, 9, 5584, {0x0p+0, 0x0p+0}},
+    {0x1.c001696115e47p+6, 5, 2994, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e66e5b746e5c5p+15, 8, 4072, {0x0p+0, 0x0p+0}},
+    {0x1.bcf2ed5d76d48p+16, 8, 2996, {0x0p+0, 0x0p+0}},
+    {0x1.0dd48f63e2937p+2, 10, 2998, {0x0p+0, 0x0p+0}},
+    {0x1.d296f01e9cb44p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7700ad95c3828p+16, 8, 3000, {0x0p+0, 0x0p+0}},
+    {0x1.97e88a302eb0ap+5, 1, 4082, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 3002, {0x0p+0, 0x0p+0}},
+    {0x1.3e45ffc45421dp+17, 7, 5608, {0x0p+0, 0x0p+0}},
+    {0x1.ca4c5ac957a94p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.729dbc010c96cp+1, 11, 3004, {0x0p+0, 0x0p+0}},
+    {0x1.eed2db7b3767dp-2, 12, 3006, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f373b3e11adb5p+40, 9, 3008, {0x0p+0, 0x0p+0}},
+    {0x1.5ee7edce308f9p+16, 8, 3010, {0x0p+0, 0x0p+0}},
+    {0x1.b4996d8bfd3ep+16, 8, 5626, {0x0p+0, 0x0p+0}},
+    {0x1.34508b5b76251p+1, 0, 3012, {0x0p+0, 0x0p+0}},
+    {0x1.5a1536bcfc097p+17, 8, 4100, {0x0p+0, 0x0p+0}},
+    {0x1.82f16ec4f0d27p+10, 4, 3014, {0x0p+0, 0x0p+0}},
+    {0x1.0ab0d7c217d75p+1, 0, 3018, {0x0p+0, 0x0p+0}},
+    {0x1.899b0b4b64148p+17, 7, 4112, {0x0p+0, 0x0p+0}},
+    {0x1.df9cab1cd441bp+1, 11, 3020, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ce2de29e77ca9p-2, 12, 3022, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.293bd7dea667ap+15, 2, 3024, {0x0p+0, 0x0p+0}},
+    {0x1.15fb2597346dfp+5, 1, 4128, {0x0p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 3026, {0x0p+0, 0x0p+0}},
+    {0x1.66d50519d67d6p+9, 4, 5672, {0x0p+0, 0x0p+0}},
+    {0x1.c001696115e47p+6, 5, 3028, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.499a9416d3f8ep+5, 1, 3030, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bccf7fd8ab803p+1, 11, 3032, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6400b4a57ef59p+7, 5, 3038, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.eec096eef466p+10, 3, 3040, {0x0p+0, 0x0p+0}},
+    {0x1.b9d6bf853fc2ap+4, 1, 3042, {0x0p+0, 0x0p+0}},
+    {0x1.f754bc2ecede8p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bcc5c25f7fa93p+1, 11, 3046, {0x0p+0, 0x0p+0}},
+    {0x1.001b56f2a0909p+25, 6, 5710, {0x0p+0, 0x0p+0}},
+    {0x1.38f716d2797dp+17, 8, 3050, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7be61b6b1eee1p+5, 1, 3052, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7bf82bed42a2cp+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.00ff4a3ce54dfp+1, 0, 3058, {0x0p+0, 0x0p+0}},
+    {0x1.e5204b8fa5dcdp+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5479754c332f8p+17, 7, 3060, {0x0p+0, 0x0p+0}},
+    {0x1.bcf36fa139112p+16, 7, 3062, {0x0p+0, 0x0p+0}},
+    {0x1.a0851b3f1d8e1p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.70c9744b090a6p+17, 7, 3066, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.628096f70c8f7p+10, 3, 3070, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7819d8428d5b5p+15, 2, 3074, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9d962ca1cb557p+16, 7, 3076, {0x0p+0, 0x0p+0}},
+    {0x1.3dfbd8290b96ep+15, 2, 5764, {0x0p+0, 0x0p+0}},
+    {0x1.2208b45148a8ap+2, 10, 3078, {0x0p+0, 0x0p+0}},
+    {0x1.1948cb8357cf7p+10, 4, 3082, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d6c29a5df957ep-2, 12, 3084, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.14cf63fdc8174p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9dc12d87d06bdp+9, 3, 3088, {0x0p+0, 0x0p+0}},
+    {0x1.c8a04b37566ebp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a48ddb9b2079ap+43, 9, 3092, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.94304b999b8a8p+11, 3, 3094, {0x0p+0, 0x0p+0}},
+    {0x1.c8a7127ae7a81p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.eb575161b64e2p-2, 12, 3098, {0x0p+0, 0x0p+0}},
+    {0x1.35bddefdead1bp+25, 6, 3100, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c860d6bad18d5p+40, 9, 4226, {0x0p+0, 0x0p+0}},
+    {0x1.102d51f6f820cp+2, 10, 3102, {0x0p+0, 0x0p+0}},
+    {0x1.9e56bf362c034p+4, 1, 3104, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.465cb03da63eep+17, 7, 3106, {0x0p+0, 0x0p+0}},
+    {0x1.31f87858e4e07p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c3b2f26ec0b8cp+42, 9, 3108, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.31dcd05f073efp+2, 10, 3112, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.00d2f0ee6f875p+1, 11, 3116, {0x0p+0, 0x0p+0}},
+    {0x1.8085d82c7733cp+15, 2, 3118, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b23e88302d576p+41, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.31ebc7fd0355ep+2, 10, 3120, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.df304bb6dbb13p+11, 3, 3122, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.452025c8f6a9ep+12, 3, 3124, {0x0p+0, 0x0p+0}},
+    {0x1.d1a096e69276fp+10, 3, 3126, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0a14bb0c8cc18p+11, 4, 3128, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bcf36fa139112p+16, 7, 3130, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1147bfd22f876p+1, 0, 3132, {0x0p+0, 0x0p+0}},
+    {0x1.cb5716d841e42p+0, 11, 3134, {0x0p+0, 0x0p+0}},
+    {0x1.9019f77ea156p+16, 7, 3136, {0x0p+0, 0x0p+0}},
+    {0x1.f856658cb8bbbp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.19627ffd1f2efp+24, 6, 3138, {0x0p+0, 0x0p+0}},
+    {0x1.f2399e0c494f2p-2, 12, 3140, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8af159a7bc378p+1, 11, 3144, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.19b3022b17888p+10, 4, 3148, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c42976a275839p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.10f04b74d2344p+11, 3, 3152, {0x0p+0, 0x0p+0}},
+    {0x1.f64bec6c52a6dp+16, 2, 3158, {0x0p+0, 0x0p+0}},
+    {0x1.4c1417c46ebe6p+43, 9, 4308, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.059c58d8d99eap+1, 0, 3160, {0x0p+0, 0x0p+0}},
+    {0x1.30fc620fb2205p+5, 1, 3162, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6c2e12d72a9a2p+1, 11, 3168, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2c08a4be81b3fp+10, 4, 3170, {0x0p+0, 0x0p+0}},
+    {0x1.f4d9c29042473p+23, 6, 3172, {0x0p+0, 0x0p+0}},
+    {0x1.d816e6d7647f5p+1, 11, 3182, {0x0p+0, 0x0p+0}},
+    {0x1.8b00b4a7b6a0bp+7, 5, 4336, {0x0p+0, 0x0p+0}},
+    {0x1.0931021202e89p+1, 0, 4340, {0x0p+0, 0x0p+0}},
+    {0x1.0207593c0820ap+24, 6, 3184, {0x0p+0, 0x0p+0}},
+    {0x1.72a3d8245af13p+15, 2, 3188, {0x0p+0, 0x0p+0}},
+    {0x1.c868b74f0004dp+25, 6, 3190, {0x0p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 4352, {0x0p+0, 0x0p+0}},
+    {0x1.b11481929818dp+41, 9, 3192, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.422cd7c1e15dfp+15, 2, 3194, {0x0p+0, 0x0p+0}},
+    {0x1.75642ddb2880cp+16, 8, 4358, {0x0p+0, 0x0p+0}},
+    {0x1.0ee024ea454e3p+2, 11, 3196, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.10f04b74d2344p+11, 3, 3202, {0x0p+0, 0x0p+0}},
+    {0x1.45404b81971e3p+11, 3, 3204, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.575e200821c45p+17, 7, 3206, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.17d1d87c74c03p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.78faedbf07166p+16, 8, 3208, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0512509cf7c57p-1, 12, 3212, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cea4b79aab2cbp-2, 12, 3220, {0x0p+0, 0x0p+0}},
+    {0x1.242b98aeba46ep+5, 1, 4390, {0x0p+0, 0x0p+0}},
+    {0x1.112351e4b0a58p+2, 10, 3222, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.457fc976cef3cp+17, 7, 3224, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e36e3c70cafd6p-2, 12, 3226, {0x0p+0, 0x0p+0}},
+    {0x1.7fe5b9d903f8fp+17, 7, 3228, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3b412df2f4881p+9, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a1f6140add39dp+40, 9, 3230, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0f49d80714209p+1, 0, 3232, {0x0p+0, 0x0p+0}},
+    {0x1.97e956becb78p+17, 8, 3234, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8005d84d71d09p+15, 2, 3238, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2c80971de6b5fp+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.00745482023a7p+1, 0, 3240, {0x0p+0, 0x0p+0}},
+    {0x1.a000b4a39b585p+7, 5, 3242, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5ba09692e9ef8p+10, 3, 3244, {0x0p+0, 0x0p+0}},
+    {0x1.cea4b79aab2cbp-2, 12, 4424, {0x0p+0, 0x0p+0}},
+    {0x1.a4e1104d54aeep+1, 11, 3246, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.071db2bda3dap+2, 10, 3248, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7a4b8be748e18p+17, 7, 3250, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6171ed74e8b5ap+16, 8, 3254, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.de6b0ed3ed158p-2, 12, 3256, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9182d816535f6p+15, 2, 3258, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dd80702802d0bp+5, 1, 3260, {0x0p+0, 0x0p+0}},
+    {0x1.c1124adc8d539p+4, 1, 4448, {0x0p+0, 0x0p+0}},
+    {0x1.697a255ce1412p+42, 9, 3264, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1365e7fc5094p+16, 7, 3266, {0x0p+0, 0x0p+0}},
+    {0x1.18cf4dfc027bbp+1, 11, 3268, {0x0p+0, 0x0p+0}},
+    {0x1.78e2d83b37134p+15, 2, 4460, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.066e22eea8aadp+2, 10, 3270, {0x0p+0, 0x0p+0}},
+    {0x1.fe22d829d5d1p+15, 2, 3274, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0522e004d474dp+6, 1, 3278, {0x0p+0, 0x0p+0}},
+    {0x1.0720a9cb41576p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.96016901efecdp+6, 5, 3280, {0x0p+0, 0x0p+0}},
+    {0x1.eb2dd82c5fbcfp+15, 2, 3282, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.09504b6ad69a9p+11, 3, 3284, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.38304b8452298p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ce59d3bd4b9fcp-2, 12, 3290, {0x0p+0, 0x0p+0}},
+    {0x1.058bec0a68e02p+16, 2, 3292, {0x0p+0, 0x0p+0}},
+    {0x1.4fb7208f03fc4p+17, 7, 4496, {0x0p+0, 0x0p+0}},
+    {0x1.7a4b8be748e18p+17, 7, 3296, {0x0p+0, 0x0p+0}},
+    {0x1.2ea5e648b7b49p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3dfbd8290b96ep+15, 2, 3298, {0x0p+0, 0x0p+0}},
+    {0x1.d04b51b1f9d04p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.51092475841d2p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.343676670b332p+17, 2, 3300, {0x0p+0, 0x0p+0}},
+    {0x1.113cb9e16405ep+1, 0, 4510, {0x0p+0, 0x0p+0}},
+    {0x1.1297fb58070e9p+2, 11, 3302, {0x0p+0, 0x0p+0}},
+    {0x1.9b8c46aeb3282p+1, 11, 3304, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.13f49ae329f4bp+2, 10, 3306, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5ea0976a62f24p+10, 3, 3310, {0x0p+0, 0x0p+0}},
+    {0x1.26f8259a8473bp+12, 3, 3312, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.170bd5509087fp+1, 11, 3314, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dd00b48187812p+7, 5, 3316, {0x0p+0, 0x0p+0}},
+    {0x1.4a64ca4260c2cp+24, 6, 3318, {0x0p+0, 0x0p+0}},
+    {0x1.e2e959963fab6p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3080d82219163p+15, 2, 3320, {0x0p+0, 0x0p+0}},
+    {0x1.427f2a5d3750cp+10, 4, 3322, {0x0p+0, 0x0p+0}},
+    {0x1.e601692d5b57cp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.045736c797756p+17, 8, 3324, {0x0p+0, 0x0p+0}},
+    {0x1.2b4ffd006e90fp+23, 6, 4544, {0x0p+0, 0x0p+0}},
+    {0x1.9e00b997043fp+24, 6, 3330, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.50c1f4fb3ddacp+24, 6, 3332, {0x0p+0, 0x0p+0}},
+    {0x1.238dd67f5ae4p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.27ca952a4858ep+10, 4, 3334, {0x0p+0, 0x0p+0}},
+    {0x1.88b2d0d7fa55cp+17, 7, 4554, {0x0p+0, 0x0p+0}},
+    {0x1.65804b8d978bbp+11, 3, 3336, {0x0p+0, 0x0p+0}},
+    {0x1.fdec0dcc95bd1p+3, 1, 4558, {0x0p+0, 0x0p+0}},
+    {0x1.414f2527ae803p+25, 6, 3340, {0x0p+0, 0x0p+0}},
+    {0x1.774badb94f713p+16, 8, 3342, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c4417b196f419p+0, 11, 3346, {0x0p+0, 0x0p+0}},
+    {0x1.bb304b83f2d84p+11, 3, 3348, {0x0p+0, 0x0p+0}},
+    {0x1.4451ae65d21e4p+16, 8, 3350, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.be9e2be6b2621p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.14f637481c8e7p+2, 10, 3352, {0x0p+0, 0x0p+0}},
+    {0x1.97c970dc8a6bap+1, 11, 4574, {0x0p+0, 0x0p+0}},
+    {0x1.648bcdf396d15p+5, 1, 3354, {0x0p+0, 0x0p+0}},
+    {0x1.075741301a8ccp+1, 0, 4582, {0x0p+0, 0x0p+0}},
+    {0x1.14ee6ded4cc1ep+16, 8, 3358, {0x0p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 3360, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5e3ed6c55a7eap+17, 8, 3362, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b84ad6d3bc13fp+1, 11, 3364, {0x0p+0, 0x0p+0}},
+    {0x1.00508df87b31dp+25, 6, 3366, {0x0p+0, 0x0p+0}},
+    {0x1.0e368f4c2cc9cp+25, 6, 4594, {0x0p+0, 0x0p+0}},
+    {0x1.1bc5187140b65p+42, 9, 3372, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.be273b37a058bp+5, 1, 3374, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.12ac5d320b5f8p+2, 10, 3378, {0x0p+0, 0x0p+0}},
+    {0x1.30b08c6bebd3cp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.631ce38247875p+17, 7, 3382, {0x0p+0, 0x0p+0}},
+    {0x1.902e7317cf5cdp+43, 9, 3386, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7268eeadd5aa4p+1, 11, 3388, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a2246d9835c87p+16, 8, 3390, {0x0p+0, 0x0p+0}},
+    {0x1.1ce0ebf112b8ap+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c52149301bf14p-2, 12, 3392, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.92c5b6c46336bp+17, 8, 3394, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.aa95d82ac646fp+15, 2, 3400, {0x0p+0, 0x0p+0}},
+    {0x1.fd550811c3c42p+41, 9, 3402, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.31ae4acf70325p+5, 1, 3404, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa00b4ba42dc6p+7, 5, 3406, {0x0p+0, 0x0p+0}},
+    {0x1.5acfa6e875e12p+10, 4, 3408, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.53f4d81bb5dcfp+15, 2, 3410, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0da698d0f9c1dp+43, 9, 3412, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c732d93fa3286p-2, 12, 3416, {0x0p+0, 0x0p+0}},
+    {0x1.058bec0a68e02p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3096e9cb16806p+2, 10, 3418, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.18ec0cc4712eep+2, 10, 3422, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.94a04b84391ecp+11, 3, 3426, {0x0p+0, 0x0p+0}},
+    {0x1.bcb9c7297dfa8p+0, 11, 3428, {0x0p+0, 0x0p+0}},
+    {0x1.8afb87fbf126bp+5, 1, 4680, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e2849d5793b8cp+1, 11, 3436, {0x0p+0, 0x0p+0}},
+    {0x1.c76e119c68fc5p+16, 7, 3438, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.04ab41c255c71p-1, 12, 3440, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.11478b811fd62p+18, 8, 3442, {0x0p+0, 0x0p+0}},
+    {0x1.2405aca6b378bp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8809414d385dbp+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bc6c4d19984ddp+42, 9, 3444, {0x0p+0, 0x0p+0}},
+    {0x1.561d96bbc1c97p+17, 8, 3452, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a100b4a5df4bep+7, 5, 3454, {0x0p+0, 0x0p+0}},
+    {0x1.538059ef7d43fp+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.dc8951778bd63p+0, 0, 3456, {0x0p+0, 0x0p+0}},
+    {0x1.22b44ddf6e3fp+1, 11, 4718, {0x0p+0, 0x0p+0}},
+    {0x1.e04a84eea611dp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e0204b5bc54d9p+11, 3, 3458, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dee0972aeab1cp+10, 3, 3460, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c85a5baf97556p+15, 8, 3464, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ddb1920fbb94p-2, 12, 3466, {0x0p+0, 0x0p+0}},
+    {0x1.907716d678b1fp+17, 8, 4736, {0x0p+0, 0x0p+0}},
+    {0x1.3c4fda69ff0b7p+1, 0, 3468, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.853fd84a24073p+15, 2, 3470, {0x0p+0, 0x0p+0}},
+    {0x1.d0e04b8169d04p+11, 3, 3472, {0x0p+0, 0x0p+0}},
+    {0x1.88d02557cab12p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a0a04b652fa4cp+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.075c1e5b6bd42p-1, 12, 3478, {0x0p+0, 0x0p+0}},
+    {0x1.513957461a3f3p+17, 7, 3480, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8843a30e264d8p+17, 7, 3482, {0x0p+0, 0x0p+0}},
+    {0x1.ca016977bd689p+6, 5, 3484, {0x0p+0, 0x0p+0}},
+    {0x1.ebc9fb0b22b1fp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.08a98f088e8p+24, 6, 3486, {0x0p+0, 0x0p+0}},
+    {0x1.e2b4a5372bb6p+0, 0, 3488, {0x0p+0, 0x0p+0}},
+    {0x1.121cf1dbff6aap+1, 0, 3492, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e36e3c70cafd6p-2, 12, 3494, {0x0p+0, 0x0p+0}},
+    {0x1.b93aaceda3b72p+41, 9, 3496, {0x0p+0, 0x0p+0}},
+    {0x1.fe58f49ab85adp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2e0d43aae2e6bp+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a0b6875d70843p+4, 1, 3498, {0x0p+0, 0x0p+0}},
+    {0x1.ee12803b6879dp-2, 12, 3500, {0x0p+0, 0x0p+0}},
+    {0x1.0be6cb9e6b348p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.11ae5918e4c5p+2, 10, 4784, {0x0p+0, 0x0p+0}},
+    {0x1.1f9f96cee31a4p+17, 8, 3502, {0x0p+0, 0x0p+0}},
+    {0x1.2ea04b7a660b4p+11, 3, 3504, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.eb633ad1eda14p+9, 4, 3506, {0x0p+0, 0x0p+0}},
+    {0x1.6c856ac96f9cbp+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.60b02d5b4e34cp+16, 8, 3508, {0x0p+0, 0x0p+0}},
+    {0x1.30304b87027cbp+11, 3, 4728, {0x0p+0, 0x0p+0}},
+    {0x1.c14dc0817b8eap+24, 6, 3510, {0x0p+0, 0x0p+0}},
+    {0x1.e7bd4dc08fe04p-2, 12, 4806, {0x0p+0, 0x0p+0}},
+    {0x1.207626d7c400bp+1, 0, 3512, {0x0p+0, 0x0p+0}},
+    {0x1.cee6cf311254fp+1, 11, 4814, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.562cbb2f09e3fp+10, 4, 3516, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2247c5aa38c23p+1, 0, 3518, {0x0p+0, 0x0p+0}},
+    {0x1.e48ab5f1b7703p-2, 12, 3520, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dcee6dc721c31p+16, 8, 3522, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.23450147d8d7p+4, 1, 3526, {0x0p+0, 0x0p+0}},
+    {0x1.dd7cbbfee33eep-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.062dba23e2d36p+2, 10, 3530, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5d804b7713bf4p+11, 3, 3532, {0x0p+0, 0x0p+0}},
+    {0x1.d292a6504e66dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.abd0457bc5146p+1, 11, 4838, {0x0p+0, 0x0p+0}},
+    {0x1.ea12410a31ecep-2, 12, 3534, {0x0p+0, 0x0p+0}},
+    {0x1.61336d57496ebp+16, 8, 3538, {0x0p+0, 0x0p+0}},
+    {0x1.f750d5e1d5578p+0, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.159c93b739527p+1, 0, 3540, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24888cc8c5b04p+10, 4, 4848, {0x0p+0, 0x0p+0}},
+    {0x1.62cfed9657cp+16, 8, 3544, {0x0p+0, 0x0p+0}},
+    {0x1.9ba5a3e289c7bp+17, 7, 3546, {0x0p+0, 0x0p+0}},
+    {0x1.b9006bea5cb5cp+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.af00b4a32270fp+7, 5, 3548, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f0b5a6695d28p+16, 7, 4862, {0x0p+0, 0x0p+0}},
+    {0x1.c1202d66025f5p+16, 7, 3550, {0x0p+0, 0x0p+0}},
+    {0x1.1289f9644bf8fp+2, 11, 3552, {0x0p+0, 0x0p+0}},
+    {0x1.0134bf9181cedp+45, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.decfb12c40978p+14, 2, 3554, {0x0p+0, 0x0p+0}},
+    {0x1.52552d47608ecp+16, 8, 3556, {0x0p+0, 0x0p+0}},
+    {0x1.1b00b489ef33ep+7, 5, 4864, {0x0p+0, 0x0p+0}},
+    {0x1.1880afcf2e104p+24, 6, 4870, {0x0p+0, 0x0p+0}},
+    {0x1.5a4d66b602e12p+10, 4, 3558, {0x0p+0, 0x0p+0}},
+    {0x1.0180dc25a484p+17, 7, 3562, {0x0p+0, 0x0p+0}},
+    {0x1.99cc0c071cabap+41, 9, 3564, {0x0p+0, 0x0p+0}},
+    {0x1.c22025308101ap+16, 7, 3566, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6734219e66894p+1, 11, 3568, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.20b9a16950ec5p+41, 9, 3572, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b48431040ac11p+12, 4, 3574, {0x0p+0, 0x0p+0}},
+    {0x1.de0169a50c70dp+6, 5, 3576, {0x0p+0, 0x0p+0}},
+    {0x1.bcd993bad9d67p+16, 7, 3578, {0x0p+0, 0x0p+0}},
+    {0x1.0e8025cc86e38p+12, 3, 3580, {0x0p+0, 0x0p+0}},
+    {0x1.d4f4649c0c929p+0, 0, 3584, {0x0p+0, 0x0p+0}},
+    {0x1.37b9bbaeaaebep+18, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.58533915ace3cp+24, 6, 3588, {0x0p+0, 0x0p+0}},
+    {0x1.2f4bab7e4af36p+10, 4, 4910, {0x0p+0, 0x0p+0}},
+    {0x1.01341acf53af1p+1, 0, 3590, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.13456e2cc5186p+16, 8, 3592, {0x0p+0, 0x0p+0}},
+    {0x1.37900cb114341p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1fd82d61c43f9p+42, 9, 3594, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4789d16b975cfp+17, 7, 3596, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f8168429a18f5p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c1202d66025f5p+16, 7, 3600, {0x0p+0, 0x0p+0}},
+    {0x1.fe512b3e98362p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0470d84fa01dap+2, 10, 3602, {0x0p+0, 0x0p+0}},
+    {0x1.150df0405f58dp+17, 7, 3604, {0x0p+0, 0x0p+0}},
+    {0x1.6491ed62b8b91p+16, 8, 4940, {0x0p+0, 0x0p+0}},
+    {0x1.4ed2f8d8f8cbp+4, 1, 3608, {0x0p+0, 0x0p+0}},
+    {0x1.980d0394c159ap+41, 9, 4416, {0x0p+0, 0x0p+0}},
+    {0x1.ec59f3057b4f7p-2, 12, 3610, {0x0p+0, 0x0p+0}},
+    {0x1.c6ce09e48cdadp+1, 11, 3612, {0x0p+0, 0x0p+0}},
+    {0x1.5a6fd85412329p+15, 2, 3614, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e275a955129d2p+17, 7, 3618, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.13456e2cc5186p+16, 8, 3620, {0x0p+0, 0x0p+0}},
+    {0x1.bc6c4d19984ddp+42, 9, 3622, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fecbd51598a51p+4, 1, 3626, {0x0p+0, 0x0p+0}},
+    {0x1.e0f1d829b500bp+15, 2, 3628, {0x0p+0, 0x0p+0}},
+    {0x1.54cfec4966fe5p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1de04b6de9c29p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0e3e10eff532p+1, 0, 3630, {0x0p+0, 0x0p+0}},
+    {0x1.c4012ddd11539p+16, 8, 3632, {0x0p+0, 0x0p+0}},
+    {0x1.a1a0d6e128384p+4, 1, 3634, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2553ec16fe6bcp+16, 2, 3636, {0x0p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 3638, {0x0p+0, 0x0p+0}},
+    {0x1.05b2ab0017f14p+2, 10, 4986, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.12c775ccc071p+11, 4, 3640, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a4d954cb34283p+42, 9, 3642, {0x0p+0, 0x0p+0}},
+    {0x1.53434ab4f3178p+6, 1, 3648, {0x0p+0, 0x0p+0}},
+    {0x1.13994d222a1a8p+13, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.519b37ead1acp+44, 9, 3650, {0x0p+0, 0x0p+0}},
+    {0x1.283d153609da7p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.971f0c38901fep+1, 11, 5014, {0x0p+0, 0x0p+0}},
+    {0x1.bd7e794ef8054p+1, 11, 3654, {0x0p+0, 0x0p+0}},
+    {0x1.54ded6dacda06p+17, 8, 3656, {0x0p+0, 0x0p+0}},
+    {0x1.640096ef91a4dp+10, 3, 5016, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ebfbf077d937ap-2, 12, 3658, {0x0p+0, 0x0p+0}},
+    {0x1.1e653d3696923p+18, 7, 3660, {0x0p+0, 0x0p+0}},
+    {0x1.c31676e6cc0fap+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.38942617924cap+2, 10, 3662, {0x0p+0, 0x0p+0}},
+    {0x1.9d012ee534251p+9, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e5c02987cd3bap+0, 0, 3664, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.deb5f269c224cp-2, 12, 3668, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.41604b81b614fp+11, 3, 3670, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9858c8bfb04fcp+2, 1, 3678, {0x0p+0, 0x0p+0}},
+    {0x1.e66e5b746e5c5p+15, 8, 5042, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3f575c34e0963p+2, 1, 3682, {0x0p+0, 0x0p+0}},
+    {0x1.1ad26a29ffc3p+5, 1, 3684, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.109d44ea00e6ap+1, 0, 3686, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.02ade4cd4fedbp+1, 0, 3690, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.60c0e859efb5ep+41, 9, 3692, {0x0p+0, 0x0p+0}},
+    {0x1.b11481929818dp+41, 9, 3700, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.48dd03e2c0923p+24, 6, 3702, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4219c63f4a384p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f1c64e10dae5ap+0, 0, 3708, {0x0p+0, 0x0p+0}},
+    {0x1.16f0aa0a5ee23p+1, 0, 3710, {0x0p+0, 0x0p+0}},
+    {0x1.43d405067465fp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d957ade3432d8p+16, 8, 3712, {0x0p+0, 0x0p+0}},
+    {0x1.c945fa529928dp+10, 4, 5098, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.be84f67b5bbb7p+1, 11, 3714, {0x0p+0, 0x0p+0}},
+    {0x1.e36fadad17645p+1, 11, 3716, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9c7aa0e71ffabp+4, 1, 3718, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0da82a288cf82p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1f3fceabbce12p+18, 7, 3720, {0x0p+0, 0x0p+0}},
+    {0x1.1b8a3f6a420ecp+5, 1, 3722, {0x0p+0, 0x0p+0}},
+    {0x1.1c77a3278d3d3p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7438d84cf4441p+15, 2, 3724, {0x0p+0, 0x0p+0}},
+    {0x1.e26a1f4c5f76ep-2, 12, 3726, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e52b078b0e80fp+1, 11, 3728, {0x0p+0, 0x0p+0}},
+    {0x1.dc5ee89f4743p+17, 7, 5124, {0x0p+0, 0x0p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 3732, {0x0p+0, 0x0p+0}},
+    {0x1.0d0805f71fb7dp+2, 10, 3734, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.01b1342f56931p+24, 6, 3736, {0x0p+0, 0x0p+0}},
+    {0x1.889b62824109bp+12, 4, 3740, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.36406c1aaf9cp+16, 2, 3746, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e190509481ea4p-2, 12, 3748, {0x0p+0, 0x0p+0}},
+    {0x1.1c49b122c1f17p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.70f7723d29dcap+16, 7, 3756, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3c00b4a10356dp+7, 5, 3758, {0x0p+0, 0x0p+0}},
+    {0x1.4fb7208f03fc4p+17, 7, 3760, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 3762, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3000b4970e023p+7, 5, 3764, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.888ec4ce4977bp+16, 7, 3766, {0x0p+0, 0x0p+0}},
+    {0x1.ced35446bb877p-2, 12, 5174, {0x0p+0, 0x0p+0}},
+    {0x1.5300b4a16ff5ap+7, 5, 3772, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0dc7a1f8d7e45p+5, 1, 3774, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.48ce16c5640cp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.24ca9a141c704p+1, 0, 3776, {0x0p+0, 0x0p+0}},
+    {0x1.1057b6702b39dp+2, 10, 3780, {0x0p+0, 0x0p+0}},
+    {0x1.01083d06f9083p+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.cf33d0d81c1dap+1, 11, 3782, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6de09744be6f9p+10, 3, 3784, {0x0p+0, 0x0p+0}},
+    {0x1.ff951af284489p+12, 4, 3786, {0x0p+0, 0x0p+0}},
+    {0x1.4ab04b8a7add6p+11, 3, 5196, {0x0p+0, 0x0p+0}},
+    {0x1.d1c5e0f5a8ff3p+1, 11, 3788, {0x0p+0, 0x0p+0}},
+    {0x1.0c48a5954d056p+1, 0, 3792, {0x0p+0, 0x0p+0}},
+    {0x1.2d1e5fb3cb194p+10, 4, 5208, {0x0p+0, 0x0p+0}},
+    {0x1.951cf42214c9fp+11, 4, 3794, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.551abd6751d8cp+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a838bbe019479p+1, 11, 3796, {0x0p+0, 0x0p+0}},
+    {0x1.70c9744b090a6p+17, 7, 3798, {0x0p+0, 0x0p+0}},
+    {0x1.13277c3a82c5fp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.099025a1f07e2p+12, 3, 3802, {0x0p+0, 0x0p+0}},
+    {0x1.92c12825f3b4fp+17, 7, 3804, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2b600fa6393adp+5, 1, 3806, {0x0p+0, 0x0p+0}},
+    {0x1.0e8c7209d1d5cp+1, 0, 3808, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ca0794d15f3dap+1, 11, 3812, {0x0p+0, 0x0p+0}},
+    {0x1.59eed862a02e6p+15, 2, 3816, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c4012ddd11539p+16, 8, 5246, {0x0p+0, 0x0p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 3818, {0x0p+0, 0x0p+0}},
+    {0x1.3ff025ec6f08fp+12, 3, 3820, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.25c8825a9bbbdp+2, 10, 3822, {0x0p+0, 0x0p+0}},
+    {0x1.d72f1fe19f05ep-2, 12, 3826, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f31ed264ca535p+15, 7, 3828, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eb259ed311acdp-2, 12, 5264, {0x0p+0, 0x0p+0}},
+    {0x1.09a92f9e4ccb3p+10, 4, 3830, {0x0p+0, 0x0p+0}},
+    {0x1.62cfed9657cp+16, 8, 3836, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.eebe5a3c65307p+16, 7, 3838, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7e7a1c618647dp+9, 4, 3842, {0x0p+0, 0x0p+0}},
+    {0x1.8967473123a3p+4, 1, 3848, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5b4c0eae0812ap+40, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bdb8c1b49570bp+0, 11, 3852, {0x0p+0, 0x0p+0}},
+    {0x1.039f3a8adaad9p+2, 10, 3854, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b7ad2478d194ep+4, 1, 5302, {0x0p+0, 0x0p+0}},
+    {0x1.a000b4a39b585p+7, 5, 3858, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0a00b4cac88efp+7, 5, 3860, {0x0p+0, 0x0p+0}},
+    {0x1.586f0a8414b1ep+17, 7, 3862, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0e00b48ef0026p+7, 5, 3866, {0x0p+0, 0x0p+0}},
+    {0x1.28cecadd25cf1p+10, 4, 3868, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.39756cf10f0e4p+5, 1, 3870, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7a8da445ae51ep+9, 4, 3872, {0x0p+0, 0x0p+0}},
+    {0x1.45f7788aea01fp+43, 9, 3874, {0x0p+0, 0x0p+0}},
+    {0x1.32e221f8a90b6p+6, 1, 3880, {0x0p+0, 0x0p+0}},
+    {0x1.abee14dd43c5ep+0, 11, 3882, {0x0p+0, 0x0p+0}},
+    {0x1.7af07ea1013bep+42, 9, 3884, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.51eacdd0cdf48p+2, 10, 3886, {0x0p+0, 0x0p+0}},
+    {0x1.cdf3a1863c2c8p+1, 11, 3888, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0f416117122ccp+1, 0, 3892, {0x0p+0, 0x0p+0}},
+    {0x1.a76096e60856fp+10, 3, 3894, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4f7760f2d106cp+10, 4, 3896, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8ed4ae036dd2p+16, 8, 3902, {0x0p+0, 0x0p+0}},
+    {0x1.f80169562278cp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ea9093de411dep-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.92e45e9515bffp+17, 7, 3904, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.89b2cca134407p+2, 10, 3910, {0x0p+0, 0x0p+0}},
+    {0x1.9e248119e9c52p+1, 11, 3912, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2fcd8f85aa6a2p+5, 1, 3914, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.740830ebd71cfp+24, 6, 3916, {0x0p+0, 0x0p+0}},
+    {0x1.b4606abefc7e7p+5, 1, 3918, {0x0p+0, 0x0p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 3920, {0x0p+0, 0x0p+0}},
+    {0x1.8be6ada8dd1e2p+16, 8, 3922, {0x0p+0, 0x0p+0}},
+    {0x1.86af0e99b5c7cp+10, 4, 5386, {0x0p+0, 0x0p+0}},
+    {0x1.c66dfcc563644p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.11489f7202555p+5, 1, 3924, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7500b4a98df57p+7, 5, 3926, {0x0p+0, 0x0p+0}},
+    {0x1.51f20dd0b3573p+17, 7, 3928, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ee12803b6879dp-2, 12, 3930, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.760016c6cb56dp+17, 8, 3934, {0x0p+0, 0x0p+0}},
+    {0x1.4105d6baa69d1p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.df09b0d6722fbp+14, 2, 5408, {0x0p+0, 0x0p+0}},
+    {0x1.41d0dd8af5c99p+2, 10, 3936, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.de0169a50c70dp+6, 5, 3942, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.15596dd1353b9p+2, 10, 3944, {0x0p+0, 0x0p+0}},
+    {0x1.1c3cb6772e962p+1, 11, 3946, {0x0p+0, 0x0p+0}},
+    {0x1.279b56df8b77p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c4412e47e0f85p+9, 3, 3950, {0x0p+0, 0x0p+0}},
+    {0x1.581b3e49d8935p+5, 1, 5430, {0x0p+0, 0x0p+0}},
+    {0x1.f8d5d6a2b5c9p+17, 8, 3952, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0440880ba3e8dp+2, 10, 3954, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3b00b49ebf633p+7, 5, 3956, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2783c3ca88e71p+17, 7, 3958, {0x0p+0, 0x0p+0}},
+    {0x1.1fcfd836b1c8fp+15, 2, 3960, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6afe9bc775a67p+17, 7, 3962, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6269624930efp+5, 1, 3964, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.83f62cbb35f76p+42, 9, 3972, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.51f20dd0b3573p+17, 7, 3976, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.caa52d63a3493p+16, 8, 3978, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ca004b907e9c5p+11, 3, 3980, {0x0p+0, 0x0p+0}},
+    {0x1.b8aed1024ddc5p+1, 11, 3982, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fe6c9e3d6482fp+0, 0, 3984, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.17834afc1b9cdp+17, 7, 3992, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4f16d7fa6d2fap+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.59333a032075dp+1, 11, 3994, {0x0p+0, 0x0p+0}},
+    {0x1.8d44e8a208bfdp+44, 9, 3998, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.290b841888e14p+10, 4, 4000, {0x0p+0, 0x0p+0}},
+    {0x1.535da521d6ad6p+41, 9, 4002, {0x0p+0, 0x0p+0}},
+    {0x1.df0e7e29b3852p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8e00b49d4864cp+7, 5, 4004, {0x0p+0, 0x0p+0}},
+    {0x1.2487a0ab1cf6ep+24, 6, 4006, {0x0p+0, 0x0p+0}},
+    {0x1.c4f506922fec2p+1, 11, 5496, {0x0p+0, 0x0p+0}},
+    {0x1.7560971f57da7p+10, 3, 4010, {0x0p+0, 0x0p+0}},
+    {0x1.5ab879db4a137p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.19a20c2b163efp+17, 7, 4014, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.56f04b7affa6bp+11, 3, 4016, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.772387544011p+17, 7, 4018, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f44d6a87b127fp+42, 9, 4022, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6600b4a5b8571p+7, 5, 4024, {0x0p+0, 0x0p+0}},
+    {0x1.f6b55711f8761p-2, 12, 4026, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.af504b5f2715p+11, 3, 4028, {0x0p+0, 0x0p+0}},
+    {0x1.a547a30d03b9fp+44, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.94b49543944f2p+5, 1, 4030, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.28fbd7c5e9095p+15, 2, 4032, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ac848afde888dp+24, 6, 4034, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c49c779f4d8dep+1, 11, 4038, {0x0p+0, 0x0p+0}},
+    {0x1.98bed914b1203p+10, 4, 5542, {0x0p+0, 0x0p+0}},
+    {0x1.07f2daa445811p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3dfbd8290b96ep+15, 2, 4040, {0x0p+0, 0x0p+0}},
+    {0x1.8768ad999e105p+16, 8, 4044, {0x0p+0, 0x0p+0}},
+    {0x1.0f49d80714209p+1, 0, 5552, {0x0p+0, 0x0p+0}},
+    {0x1.eb29919aff5f2p+4, 1, 4046, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0fafeecd0f58ap+2, 10, 4048, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bd812df652ac2p+9, 3, 4052, {0x0p+0, 0x0p+0}},
+    {0x1.89caa525130ccp+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3edfeda0d2a0fp+16, 8, 4058, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c6f0b20374c6ep+24, 6, 4060, {0x0p+0, 0x0p+0}},
+    {0x1.a44641a949af9p+41, 9, 4066, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 4068, {0x0p+0, 0x0p+0}},
+    {0x1.abaad441d3f8bp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1700b4a35392ep+7, 5, 4070, {0x0p+0, 0x0p+0}},
+    {0x1.3dade742377adp+11, 4, 4074, {0x0p+0, 0x0p+0}},
+    {0x1.87504b8d004b1p+11, 3, 4076, {0x0p+0, 0x0p+0}},
+    {0x1.b85a018564cabp+1, 11, 4078, {0x0p+0, 0x0p+0}},
+    {0x1.a8536bcbd9bc7p+1, 11, 5600, {0x0p+0, 0x0p+0}},
+    {0x1.0dc1c894147a9p+2, 10, 4084, {0x0p+0, 0x0p+0}},
+    {0x1.1d8fdb234502ap+2, 10, 5610, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.631ce38247875p+17, 7, 4086, {0x0p+0, 0x0p+0}},
+    {0x1.0d1c67a58a18fp+17, 7, 4088, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a60262c4979fp+43, 9, 4090, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1e66a5cdd1c42p+16, 7, 5624, {0x0p+0, 0x0p+0}},
+    {0x1.039c258c5c5a9p+43, 9, 4092, {0x0p+0, 0x0p+0}},
+    {0x1.12e187a76e223p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c5bafa7dba1b7p-2, 12, 4094, {0x0p+0, 0x0p+0}},
+    {0x1.107f77ebfb28ap+2, 11, 4098, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f70c794a07a0fp-2, 12, 4102, {0x0p+0, 0x0p+0}},
+    {0x1.6d29cad6c8b4ep+25, 6, 4104, {0x0p+0, 0x0p+0}},
+    {0x1.1a14d6ccfe79ap+17, 8, 4106, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.17d1d87c74c03p+15, 2, 4114, {0x0p+0, 0x0p+0}},
+    {0x1.9dfeeb0890a78p+9, 4, 4116, {0x0p+0, 0x0p+0}},
+    {0x1.eabcfd39969eep-2, 12, 4118, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.09f8aaa5b15acp+23, 6, 4124, {0x0p+0, 0x0p+0}},
+    {0x1.e564a3394200bp-1, 12, 4126, {0x0p+0, 0x0p+0}},
+    {0x1.e17df2c968a78p-2, 12, 4130, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5664, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.648bcdf396d15p+5, 1, 4132, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0fe547344aee8p+1, 0, 4136, {0x0p+0, 0x0p+0}},
+    {0x1.6a706fe2d119fp+1, 11, 4138, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7eb7ad9eabe36p+16, 8, 4140, {0x0p+0, 0x0p+0}},
+    {0x1.185bbba181cfdp+40, 9, 5686, {0x0p+0, 0x0p+0}},
+    {0x1.09f56b011eaf4p+6, 1, 4142, {0x0p+0, 0x0p+0}},
+    {0x1.8b33d82282927p+15, 2, 4144, {0x0p+0, 0x0p+0}},
+    {0x1.2d00b49042276p+7, 5, 4146, {0x0p+0, 0x0p+0}},
+    {0x1.0dc025d04458dp+12, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.13e273eca4d4ep+2, 10, 4148, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fe912c3bdb041p+0, 0, 4152, {0x0p+0, 0x0p+0}},
+    {0x1.3a02d0280680dp+10, 4, 4154, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2f00b494ca0eap+7, 5, 4156, {0x0p+0, 0x0p+0}},
+    {0x1.fcbe2d979d16ep+16, 8, 4158, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0de660d82bep+1, 0, 4160, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7a4b8be748e18p+17, 7, 4164, {0x0p+0, 0x0p+0}},
+    {0x1.eb40dddc446eap-2, 12, 5714, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.54de6697acab1p+17, 7, 4166, {0x0p+0, 0x0p+0}},
+    {0x1.ab4096e5e9602p+10, 3, 4170, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f0556468a9755p+11, 4, 4172, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f802d398a470ep+5, 5, 4174, {0x0p+0, 0x0p+0}},
+    {0x1.4240ad483120bp+17, 7, 4176, {0x0p+0, 0x0p+0}},
+    {0x1.9b14797e5d353p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0dfb9da2d181bp+2, 10, 4178, {0x0p+0, 0x0p+0}},
+    {0x1.87b676f53b873p+17, 8, 4180, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dff0883f693c4p-2, 12, 4184, {0x0p+0, 0x0p+0}},
+    {0x1.0476e01b68941p+1, 11, 4186, {0x0p+0, 0x0p+0}},
+    {0x1.071223aa99912p+1, 0, 5742, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.336f76c9c8d15p+17, 8, 4188, {0x0p+0, 0x0p+0}},
+    {0x1.9e0169140f89bp+6, 5, 4190, {0x0p+0, 0x0p+0}},
+    {0x1.8b73010f05f37p+45, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7e00b49b7d588p+7, 5, 4192, {0x0p+0, 0x0p+0}},
+    {0x1.f73312bb539d9p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.4700b4a017ac7p+7, 5, 4194, {0x0p+0, 0x0p+0}},
+    {0x1.4d24ba1f3c7f3p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0b00b48824279p+7, 5, 4196, {0x0p+0, 0x0p+0}},
+    {0x1.e1809765d63abp+10, 3, 5756, {0x0p+0, 0x0p+0}},
+    {0x1.102e4b8046669p+18, 8, 4202, {0x0p+0, 0x0p+0}},
+    {0x1.998c16be96756p+17, 8, 4204, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.78faedbf07166p+16, 8, 4206, {0x0p+0, 0x0p+0}},
+    {0x1.19a44af670d0ep+1, 0, 5768, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5dee1da40257dp+24, 6, 4208, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0512509cf7c57p-1, 12, 4210, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.eb7b16c601eacp+17, 8, 4212, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.138140d0d91aap+13, 4, 4216, {0x0p+0, 0x0p+0}},
+    {0x1.51ff9ccc94dcep+17, 7, 4218, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dee7952f04a8p+1, 11, 4220, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9f0c1135aa724p+1, 11, 4222, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1fe9d826fa0b5p+15, 2, 4224, {0x0p+0, 0x0p+0}},
+    {0x1.2d00b49042276p+7, 5, 4228, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fbe025759923ep-2, 12, 4230, {0x0p+0, 0x0p+0}},
+    {0x1.71b1cd2db80d8p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c36b4197bb2bdp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.16ce47335e083p+1, 0, 4232, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2d41941f4400fp+17, 7, 4234, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.86af0e99b5c7cp+10, 4, 4238, {0x0p+0, 0x0p+0}},
+    {0x1.048664cf203a7p+2, 10, 4244, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ff951af284489p+12, 4, 4248, {0x0p+0, 0x0p+0}},
+    {0x1.aebe87304ec35p+42, 9, 4250, {0x0p+0, 0x0p+0}},
+    {0x1.1a54a1765d32cp+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.4ef9e2d02f9fbp+17, 7, 4252, {0x0p+0, 0x0p+0}},
+    {0x1.e4d3ea1e294f3p-2, 12, 4254, {0x0p+0, 0x0p+0}},
+    {0x1.033c85b1232e2p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c1f5d8a370dd2p+41, 9, 4256, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c36b69932889fp+1, 11, 4260, {0x0p+0, 0x0p+0}},
+    {0x1.3dc53b8859368p+24, 6, 4262, {0x0p+0, 0x0p+0}},
+    {0x1.14e8576ac4949p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.24000517af6d4p+1, 0, 4264, {0x0p+0, 0x0p+0}},
+    {0x1.111fc40103d2cp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.058d6c1265db5p+16, 2, 4266, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.222a6996996ffp+1, 0, 4270, {0x0p+0, 0x0p+0}},
+    {0x1.a95e16bd92cd9p+17, 8, 4272, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2f46ecb903bf5p+41, 9, 4274, {0x0p+0, 0x0p+0}},
+    {0x1.a69030aa3ebafp+1, 11, 4276, {0x0p+0, 0x0p+0}},
+    {0x1.49402de4c1f4dp+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.27788b7800edcp+17, 7, 4280, {0x0p+0, 0x0p+0}},
+    {0x1.03104b8067788p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7171ffce6a11ap+4, 1, 4282, {0x0p+0, 0x0p+0}},
+    {0x1.1f4ed8453fc4cp+15, 2, 4284, {0x0p+0, 0x0p+0}},
+    {0x1.7de0978e93e38p+10, 3, 4286, {0x0p+0, 0x0p+0}},
+    {0x1.9e0096db2cdb5p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f7a0253f5fbabp-2, 12, 4288, {0x0p+0, 0x0p+0}},
+    {0x1.86924d1d0860cp+23, 6, 4290, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.927530cb41b7cp+17, 7, 4292, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bb20f6c04467ep+17, 8, 4294, {0x0p+0, 0x0p+0}},
+    {0x1.75642ddb2880cp+16, 8, 4296, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7609d84498711p+15, 2, 4298, {0x0p+0, 0x0p+0}},
+    {0x1.c57821b2ff25bp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.61e3d23661f1cp+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9a4e2aa44a337p+17, 7, 4300, {0x0p+0, 0x0p+0}},
+    {0x1.1f802d563b0bcp+9, 5, 4304, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0faea09b31c44p+1, 0, 4306, {0x0p+0, 0x0p+0}},
+    {0x1.16f522ae051d4p+2, 10, 4310, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4d0dd7d885f9cp+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3400b4a01dd0bp+7, 5, 4312, {0x0p+0, 0x0p+0}},
+    {0x1.3e82d6c41313bp+24, 6, 4314, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f002d38684d41p+5, 5, 4318, {0x0p+0, 0x0p+0}},
+    {0x1.43805a1026652p+8, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.84dee3a8d8243p+24, 6, 4320, {0x0p+0, 0x0p+0}},
+    {0x1.e4c205fcab75ep+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3dd246c05302cp+42, 9, 4322, {0x0p+0, 0x0p+0}},
+    {0x1.fdc08dea39db7p+0, 0, 4324, {0x0p+0, 0x0p+0}},
+    {0x1.661736947ea2bp+2, 10, 4326, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.891f6e0f95a9cp+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.9016e4decbce3p+9, 4, 4328, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a090c4f30dea2p+5, 1, 4330, {0x0p+0, 0x0p+0}},
+    {0x1.e1823c8b972a8p+0, 0, 4332, {0x0p+0, 0x0p+0}},
+    {0x1.6700b489d6a2ep+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9057df7f871f6p+1, 11, 4334, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1a91f9a0e4b8ap+40, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.47b968e2146b1p+41, 9, 4338, {0x0p+0, 0x0p+0}},
+    {0x1.ae0169384ec38p+6, 5, 4342, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dc24ce7f786b1p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1df3e5185854dp+17, 7, 4344, {0x0p+0, 0x0p+0}},
+    {0x1.026649c08b0d5p+6, 1, 4346, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.04686ce9fd49fp+24, 6, 4348, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7e032db92c6cbp+17, 7, 4350, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.138140d0d91aap+13, 4, 4354, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.15dbcf3e45022p+2, 10, 4356, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1163525cf9544p-1, 12, 4360, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 4362, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1d00b48e771b1p+7, 5, 4364, {0x0p+0, 0x0p+0}},
+    {0x1.3314d1f379cfp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.da01699bfca26p+6, 5, 4366, {0x0p+0, 0x0p+0}},
+    {0x1.8867d7facd64cp+15, 2, 4368, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1a54a1765d32cp+1, 0, 4372, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e6cc8c5c1b229p-2, 12, 4374, {0x0p+0, 0x0p+0}},
+    {0x1.5025255d7f259p+10, 4, 4376, {0x0p+0, 0x0p+0}},
+    {0x1.0634b331dd78fp+1, 0, 4378, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bfd04b80166c2p+11, 3, 4380, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f802d398a470ep+5, 5, 4382, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.019ffdf0216f5p-1, 12, 4386, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4c204b80e93fap+11, 3, 4388, {0x0p+0, 0x0p+0}},
+    {0x1.462e80da91ad8p+1, 0, 4392, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3a9eb608fd228p+42, 9, 4394, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.728b070909d2dp+16, 7, 4398, {0x0p+0, 0x0p+0}},
+    {0x1.49e2248a251d6p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a74096d374032p+10, 3, 4402, {0x0p+0, 0x0p+0}},
+    {0x1.09a92f9e4ccb3p+10, 4, 4404, {0x0p+0, 0x0p+0}},
+    {0x1.7f03939184c52p+42, 9, 4406, {0x0p+0, 0x0p+0}},
+    {0x1.f3c866e6d162p+0, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3c564f28fa8dap+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.32a5364c6e18bp+25, 6, 4410, {0x0p+0, 0x0p+0}},
+    {0x1.4a206139bd957p+17, 7, 4412, {0x0p+0, 0x0p+0}},
+    {0x1.c6262340db609p+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b001693cd6aabp+6, 5, 4414, {0x0p+0, 0x0p+0}},
+    {0x1.f9c9edbe895ebp+16, 8, 4332, {0x0p+0, 0x0p+0}},
+    {0x1.a5b4ed791e0a3p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.41f14f54d4827p+5, 1, 4418, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4cf064e45b94ap+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9c01690f87a28p+6, 5, 4420, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2de7d6c95f5abp+17, 8, 4422, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d466f39026d51p-2, 12, 4428, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0e5814daffe67p+6, 1, 4430, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.da370f8f41ef4p-2, 12, 4432, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.382f16d7057c2p+17, 8, 4434, {0x0p+0, 0x0p+0}},
+    {0x1.4c6915e747cf8p+17, 7, 4436, {0x0p+0, 0x0p+0}},
+    {0x1.c6ee7b007e9d6p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e7dcd83098b6bp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.14810634c697ep+18, 7, 4438, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.31dcd05f073efp+2, 10, 4440, {0x0p+0, 0x0p+0}},
+    {0x1.71fed82f4d132p+15, 2, 4442, {0x0p+0, 0x0p+0}},
+    {0x1.fcf04be2878d2p+11, 3, 4444, {0x0p+0, 0x0p+0}},
+    {0x1.f3e096fbcd93p+10, 3, 4446, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1e653d3696923p+18, 7, 4450, {0x0p+0, 0x0p+0}},
+    {0x1.460d16c042fe4p+17, 8, 4452, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.055fec1e71667p+16, 2, 4456, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.068018fd45b6p+4, 1, 4462, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.10e178932f75fp+1, 0, 4470, {0x0p+0, 0x0p+0}},
+    {0x1.9820970bacd9ap+10, 3, 4472, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4cf493e4cbe93p+42, 9, 4474, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b173c22d4fd83p+1, 11, 4480, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b600b49089eccp+7, 5, 4482, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9fe40939edb37p+1, 11, 4484, {0x0p+0, 0x0p+0}},
+    {0x1.25ed864f8f839p+5, 1, 4486, {0x0p+0, 0x0p+0}},
+    {0x1.bf00b482794fcp+7, 5, 4488, {0x0p+0, 0x0p+0}},
+    {0x1.b3bbc13ded4d7p+1, 11, 4490, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7d467a308630dp+41, 9, 4492, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3b82d60ecf0e2p+17, 7, 4494, {0x0p+0, 0x0p+0}},
+    {0x1.cee6cf311254fp+1, 11, 4498, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.14810f2ef3b3p+2, 10, 4500, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c7155c1e74ea2p+15, 8, 4502, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c72e5b21679aap+15, 8, 4504, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1ed79511dbef7p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.16e216c5bd109p+17, 8, 4506, {0x0p+0, 0x0p+0}},
+    {0x1.2f464d7d11cf6p+1, 0, 4508, {0x0p+0, 0x0p+0}},
+    {0x1.92704bb589839p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5fa9ade7cb106p+16, 8, 4514, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.867ce514b6a48p+5, 1, 4516, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d61042806c1a8p+24, 6, 4518, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6618b8a2c63ep+17, 7, 4520, {0x0p+0, 0x0p+0}},
+    {0x1.f3da06f69e455p-2, 12, 4522, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.15bbd085d3477p+17, 7, 4524, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.363902347d1fp+24, 6, 4526, {0x0p+0, 0x0p+0}},
+    {0x1.e569f5f7058b8p-2, 12, 4528, {0x0p+0, 0x0p+0}},
+    {0x1.5ba5ebf84ae2dp+16, 2, 4530, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9253d84fecc62p+15, 2, 4532, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9c996778d6ebp+5, 1, 4534, {0x0p+0, 0x0p+0}},
+    {0x1.33a471f17652ep+1, 11, 4536, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1109baff3519p+2, 10, 4540, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f9053f64b187cp+2, 1, 4542, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4459107e37721p+17, 7, 4546, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4db56c0d18d2dp+17, 7, 4548, {0x0p+0, 0x0p+0}},
+    {0x1.a60262c4979fp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9496702f30d3cp+17, 7, 4550, {0x0p+0, 0x0p+0}},
+    {0x1.cfc92bcc62336p-2, 12, 4552, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c5281b7a6c80cp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2c380522e5fb6p+2, 10, 4556, {0x0p+0, 0x0p+0}},
+    {0x1.f5f45d050020ep-2, 12, 4560, {0x0p+0, 0x0p+0}},
+    {0x1.d819aa81cf1ep+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bf75eae38f137p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d0d04b781fa66p+11, 3, 4562, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.959e7e9b3bcb3p+1, 11, 4564, {0x0p+0, 0x0p+0}},
+    {0x1.5d40e74858eb5p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d407b0f3779dp+14, 2, 4566, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0428f97e1c492p+1, 0, 4568, {0x0p+0, 0x0p+0}},
+    {0x1.0c4bd58d4bf6ep+2, 10, 4570, {0x0p+0, 0x0p+0}},
+    {0x1.1bb4ccfa7b0d7p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0382819a890e3p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ecfef05c99565p+4, 1, 4572, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.16d27fa610a7p+42, 9, 4576, {0x0p+0, 0x0p+0}},
+    {0x1.3100b49951f5dp+7, 5, 4578, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c77d1c1e6d73fp+1, 11, 4580, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0f614407b9f96p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.78392da56c959p+16, 8, 4584, {0x0p+0, 0x0p+0}},
+    {0x1.f8a42d75899f9p+16, 8, 4586, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1f904b73e6682p+11, 3, 4590, {0x0p+0, 0x0p+0}},
+    {0x1.922d45c44656ep+1, 11, 4592, {0x0p+0, 0x0p+0}},
+    {0x1.43f107b5f013fp+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e5f4509a24489p+1, 11, 4598, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.138140d0d91aap+13, 4, 4600, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.834216231b59ap+17, 7, 4602, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b7ff0d012aef1p+4, 1, 4604, {0x0p+0, 0x0p+0}},
+    {0x1.2dc2d227a1922p+10, 4, 4606, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0b204b7500a66p+11, 3, 4610, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b8e0791ab7538p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ceae1a1878abbp-2, 12, 4614, {0x0p+0, 0x0p+0}},
+    {0x1.fc297e023140cp+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8ed04b6799b5fp+11, 3, 4616, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9e00b997043fp+24, 6, 4618, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6d470747fe288p+5, 1, 4624, {0x0p+0, 0x0p+0}},
+    {0x1.11018b8b467c4p+2, 10, 4626, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0c2f17613a027p+24, 6, 4628, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2720c15df820ep+41, 9, 4630, {0x0p+0, 0x0p+0}},
+    {0x1.e1823c8b972a8p+0, 0, 4632, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e2b08e80d8de9p+5, 1, 4634, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f8607f48f41fcp+42, 9, 4636, {0x0p+0, 0x0p+0}},
+    {0x1.409c5e2e419c6p+1, 0, 4640, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.daded835e4bafp+15, 2, 4642, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a52323890e5d2p+1, 11, 4644, {0x0p+0, 0x0p+0}},
+    {0x1.0b799cd4b8c9cp+1, 0, 4646, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5d8e672e0d79cp+17, 7, 4652, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9072d828de94dp+15, 2, 4654, {0x0p+0, 0x0p+0}},
+    {0x1.8be6ada8dd1e2p+16, 8, 4656, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.05836d5eb19dep+1, 0, 4658, {0x0p+0, 0x0p+0}},
+    {0x1.27685c53b20b3p+43, 9, 4660, {0x0p+0, 0x0p+0}},
+    {0x1.83f4aa55a49b7p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9d962ca1cb557p+16, 7, 4662, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0ce1105c9c401p+1, 0, 4664, {0x0p+0, 0x0p+0}},
+    {0x1.1ee1a94484533p+5, 1, 4666, {0x0p+0, 0x0p+0}},
+    {0x1.4e575b3e792e8p+2, 10, 4668, {0x0p+0, 0x0p+0}},
+    {0x1.b422b26c9e046p+16, 7, 4670, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.001e13a9aaa89p+43, 9, 4672, {0x0p+0, 0x0p+0}},
+    {0x1.330e96cd89faep+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.77faad87cd4eap+16, 8, 4674, {0x0p+0, 0x0p+0}},
+    {0x1.b56c2313a2fafp+1, 11, 4678, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1900b4a7db7a2p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f9904bb9c0671p+11, 3, 4682, {0x0p+0, 0x0p+0}},
+    {0x1.4c5f90f4826cep+42, 9, 4684, {0x0p+0, 0x0p+0}},
+    {0x1.7699810a18524p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.6a5c9de005ac6p+2, 10, 4686, {0x0p+0, 0x0p+0}},
+    {0x1.77f46dc710a28p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.804010f1b0818p+10, 4, 4688, {0x0p+0, 0x0p+0}},
+    {0x1.15b98e1cc3a06p+10, 4, 4690, {0x0p+0, 0x0p+0}},
+    {0x1.51b04b832d33p+11, 3, 4692, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ed34713d1516ap-2, 12, 4694, {0x0p+0, 0x0p+0}},
+    {0x1.45f7788aea01fp+43, 9, 4696, {0x0p+0, 0x0p+0}},
+    {0x1.c44c2d7c29f2cp+16, 8, 4700, {0x0p+0, 0x0p+0}},
+    {0x1.b800b4b786017p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f7e0105610353p+1, 11, 4702, {0x0p+0, 0x0p+0}},
+    {0x1.1e7b23e7a6a1ep+2, 10, 4706, {0x0p+0, 0x0p+0}},
+    {0x1.31c04b7e0489dp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1d20ef977da91p+2, 10, 4708, {0x0p+0, 0x0p+0}},
+    {0x1.2c84c12a96b53p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.10604b77a04c3p+11, 3, 4710, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c4304b5711588p+11, 3, 4712, {0x0p+0, 0x0p+0}},
+    {0x1.d68a9a1dfc307p+0, 0, 4714, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.42b67b616dfabp+17, 7, 4716, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.acd10569e129p+1, 11, 4722, {0x0p+0, 0x0p+0}},
+    {0x1.aa0097128cf25p+10, 3, 4724, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0c00b4cf50762p+7, 5, 4726, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa00b4ba42dc6p+7, 5, 4728, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.228b51fb4a226p+4, 1, 4730, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f92fb0183fb8ap+14, 2, 4734, {0x0p+0, 0x0p+0}},
+    {0x1.35da6a365e27bp+2, 10, 4738, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e9fcb790521b2p-2, 12, 4740, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9f903d50bc77bp+17, 7, 4742, {0x0p+0, 0x0p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 4746, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.463ed17bc68a3p+1, 0, 4748, {0x0p+0, 0x0p+0}},
+    {0x1.5722d1f9ee78dp+10, 4, 4750, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c94d6d87643a8p+16, 8, 4752, {0x0p+0, 0x0p+0}},
+    {0x1.3d5d2401e7181p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.70404b6ffcdb6p+11, 3, 4754, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.51e1ddd665f9ap+10, 4, 4760, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 4762, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.48daa8dca1ac2p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c205ec688342ap+16, 2, 4764, {0x0p+0, 0x0p+0}},
+    {0x1.2000b4c8f13a2p+7, 5, 4766, {0x0p+0, 0x0p+0}},
+    {0x1.ce59d3bd4b9fcp-2, 12, 4768, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c400b48dcd11dp+7, 5, 4774, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8098edbc1627bp+16, 8, 4776, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6ba882ed80059p+5, 1, 4778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.19746e84f3dafp+10, 4, 4782, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.43516daa2506fp+16, 8, 4786, {0x0p+0, 0x0p+0}},
+    {0x1.d6016992ecd3ep+6, 5, 4788, {0x0p+0, 0x0p+0}},
+    {0x1.dccc557fb1de1p-2, 12, 4790, {0x0p+0, 0x0p+0}},
+    {0x1.84552db1bab4ap+16, 8, 4792, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1876f5fffcd47p+2, 10, 4804, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.017f9ce035351p+17, 7, 4808, {0x0p+0, 0x0p+0}},
+    {0x1.3c69d6a9bd6f6p+17, 7, 4810, {0x0p+0, 0x0p+0}},
+    {0x1.672efc5ca9452p+5, 1, 4812, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.30d7e5811eb13p+17, 7, 4816, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 4818, {0x0p+0, 0x0p+0}},
+    {0x1.9ba5a3e289c7bp+17, 7, 4820, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9e248119e9c52p+1, 11, 4822, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.08995f3d39609p+11, 4, 4824, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1f12275590ee4p+2, 10, 4826, {0x0p+0, 0x0p+0}},
+    {0x1.2eb28008493cdp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c7c7f6c351fe5p+41, 9, 4830, {0x0p+0, 0x0p+0}},
+    {0x1.1f6b45ea131f7p+1, 0, 4832, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.951eb773c1368p+24, 6, 4834, {0x0p+0, 0x0p+0}},
+    {0x1.158a8f44dcd4fp+5, 1, 4836, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.110061e4b0a8cp+42, 9, 4840, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.05c6cece13a8ap+2, 10, 4842, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8e3e4e2f9431p+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9600b48cf3d43p+7, 5, 4844, {0x0p+0, 0x0p+0}},
+    {0x1.bc104b92c9b6bp+11, 3, 4846, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6ea485123077ep+24, 6, 4850, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6f4e322f9dfd2p+41, 9, 4852, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.76abf6c579481p+17, 8, 4854, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.137002e8a2e28p+2, 10, 4856, {0x0p+0, 0x0p+0}},
+    {0x1.3925d7f63d3fp+15, 2, 4858, {0x0p+0, 0x0p+0}},
+    {0x1.0b00b48824279p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a44641a949af9p+41, 9, 4860, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f1ada86b0578dp-2, 12, 4866, {0x0p+0, 0x0p+0}},
+    {0x1.7113ec0f6a39ep+16, 2, 4868, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.49dd2db8252d2p+17, 7, 4872, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b3c3e7d945cbp+0, 11, 4874, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7ea4bd58d1009p+24, 6, 4876, {0x0p+0, 0x0p+0}},
+    {0x1.d600b4b69432dp+7, 5, 4878, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ff6e87bd484dfp+0, 0, 4882, {0x0p+0, 0x0p+0}},
+    {0x1.c4b02dab8f31p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.04c75e3afdafbp+2, 10, 4884, {0x0p+0, 0x0p+0}},
+    {0x1.9f00b4a15764bp+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.883fd8292f0cep+15, 2, 4886, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4286d7cae6fe9p+15, 2, 4888, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.871dad761221ap+16, 8, 4890, {0x0p+0, 0x0p+0}},
+    {0x1.17f118f59d938p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 4892, {0x0p+0, 0x0p+0}},
+    {0x1.4ebed7c3cb77bp+15, 2, 4894, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.10a8f5c7d5fe7p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.523eebfd3c0b5p+16, 2, 4896, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.892096e34297ep+10, 3, 4898, {0x0p+0, 0x0p+0}},
+    {0x1.111da45fabde6p+1, 0, 4900, {0x0p+0, 0x0p+0}},
+    {0x1.e708313062c88p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ed289eca283c5p-2, 12, 4904, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bb304b83f2d84p+11, 3, 4906, {0x0p+0, 0x0p+0}},
+    {0x1.1feebd5d78fc5p+2, 10, 4908, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0e1752d4c0183p+42, 9, 4912, {0x0p+0, 0x0p+0}},
+    {0x1.bd80972486743p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e40169b2a4267p+6, 5, 4916, {0x0p+0, 0x0p+0}},
+    {0x1.61d56989dd2dfp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.6ca06d9519b06p+16, 8, 4918, {0x0p+0, 0x0p+0}},
+    {0x1.c90eed69c4f3ap+16, 8, 4920, {0x0p+0, 0x0p+0}},
+    {0x1.1df3e5185854dp+17, 7, 4922, {0x0p+0, 0x0p+0}},
+    {0x1.14a1be5dd5ad7p+1, 0, 4924, {0x0p+0, 0x0p+0}},
+    {0x1.079fab7482333p+18, 8, 4926, {0x0p+0, 0x0p+0}},
+    {0x1.1f6718b29094dp+17, 7, 4930, {0x0p+0, 0x0p+0}},
+    {0x1.d9204b5845c5dp+11, 3, 4932, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c520ae0f3a8dfp+1, 11, 4936, {0x0p+0, 0x0p+0}},
+    {0x1.95f5a7465996p+1, 11, 4938, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.59c9d84c97b38p+15, 2, 4942, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.afdcede39238dp+16, 8, 4946, {0x0p+0, 0x0p+0}},
+    {0x1.26e7821d66a98p+2, 10, 4948, {0x0p+0, 0x0p+0}},
+    {0x1.0700b46ca42ccp+7, 5, 4950, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f5bf8678a6afp+0, 0, 4954, {0x0p+0, 0x0p+0}},
+    {0x1.3dfc13b9589abp+1, 11, 4956, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7c0168c7092efp+6, 5, 4960, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1dd09259605bap+41, 9, 4962, {0x0p+0, 0x0p+0}},
+    {0x1.461356cb80872p+17, 8, 4966, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a1a0d6e128384p+4, 1, 4968, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.75c0d82af41c5p+15, 2, 4970, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e63ba7f76020dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3d10e1242b641p+25, 6, 4974, {0x0p+0, 0x0p+0}},
+    {0x1.34a6e5772e067p+24, 6, 4980, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b687cf7817c83p+24, 6, 4982, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0fcb06d7cd366p+1, 0, 4984, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.15d9c524dc1a6p+1, 0, 4988, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ba8b0b1e23a6cp+1, 11, 4990, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa00b4ba42dc6p+7, 5, 4992, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a25c186df5f44p+25, 6, 4994, {0x0p+0, 0x0p+0}},
+    {0x1.e10a542bff0ccp+0, 0, 4996, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ad3ca3107ad2dp+12, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.98c4d84bbad79p+15, 2, 4998, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1c48b6babc081p+11, 4, 5000, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9e282f2130ecbp+17, 7, 5002, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.effe1bac21b15p+1, 11, 5006, {0x0p+0, 0x0p+0}},
+    {0x1.e9c1fa71dbca4p+4, 1, 5008, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e2c500823f28ap-2, 12, 5012, {0x0p+0, 0x0p+0}},
+    {0x1.b34d47697faa7p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0d805a1fa1b81p+8, 5, 5018, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f95b2ae9bb80ep+9, 4, 5022, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e513f817c513ap-2, 12, 5024, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24b04b9659f97p+11, 3, 5026, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9801690677d4p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3eb529110c87ep+17, 7, 5030, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0bd04b84c6e23p+11, 3, 5032, {0x0p+0, 0x0p+0}},
+    {0x1.872bac83e8956p+41, 9, 5034, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9e270e10124a6p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b99e950a784f1p+24, 6, 5036, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b642f4b68299ap+1, 11, 5038, {0x0p+0, 0x0p+0}},
+    {0x1.aec075d172279p+41, 9, 5040, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8e5ded88ebf05p+16, 8, 5046, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.900168f458372p+6, 5, 5048, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5c1a83e18f77fp+10, 4, 5050, {0x0p+0, 0x0p+0}},
+    {0x1.3b897a6179a44p+25, 6, 5052, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ed871d965966bp+5, 1, 5056, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.75c0d82af41c5p+15, 2, 5058, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.24888cc8c5b04p+10, 4, 5060, {0x0p+0, 0x0p+0}},
+    {0x1.83102d9c24f9dp+16, 8, 5064, {0x0p+0, 0x0p+0}},
+    {0x1.f084d73e92ee6p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1e80a5001e0fap+25, 6, 5066, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6463d81bfbe34p+15, 2, 5072, {0x0p+0, 0x0p+0}},
+    {0x1.c1c537af55cb6p+1, 11, 5074, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.10883b17faadap+1, 0, 5076, {0x0p+0, 0x0p+0}},
+    {0x1.1df9b6cd9cf2fp+17, 8, 5078, {0x0p+0, 0x0p+0}},
+    {0x1.21f9e525c09c3p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.fba410b745133p+0, 0, 5080, {0x0p+0, 0x0p+0}},
+    {0x1.7bcb00b03a35dp+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0c11c2d31854ep+2, 10, 5082, {0x0p+0, 0x0p+0}},
+    {0x1.f833064276adep+4, 1, 5084, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1d866ddc659f4p+16, 8, 5088, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eda9a312c1914p-2, 12, 5090, {0x0p+0, 0x0p+0}},
+    {0x1.6c276c0395269p+16, 2, 5092, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.de0169a50c70dp+6, 5, 5094, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3fd17bc093376p+1, 0, 5096, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cf68aa7f69977p+10, 4, 5100, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.22ecc84ab428ap+25, 6, 5102, {0x0p+0, 0x0p+0}},
+    {0x1.ebe86dbbeaf7p-2, 12, 5106, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.da6eb7faf54c9p+3, 1, 5108, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ee2e074c4b3d4p-2, 12, 5110, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6b0356c7c9726p+5, 1, 5112, {0x0p+0, 0x0p+0}},
+    {0x1.d957ade3432d8p+16, 8, 5114, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0289de44fcb7p+1, 0, 5116, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.96e2fcf72c1b2p+41, 9, 5120, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3e3dd7c1b7847p+15, 2, 5122, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0b2d4c2d5cfb4p+43, 9, 5128, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.36be56d6177efp+17, 8, 5134, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1dbcd7af01a23p+15, 2, 5138, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.31dcd05f073efp+2, 10, 5140, {0x0p+0, 0x0p+0}},
+    {0x1.3dfbd8290b96ep+15, 2, 5142, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0590d348d119dp+12, 4, 5144, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e610458d447d2p+17, 7, 5146, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2555159423cabp+2, 10, 5148, {0x0p+0, 0x0p+0}},
+    {0x1.36e430c54feeep+4, 1, 5150, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cb8a04335c7aap-2, 12, 5154, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2368ba7770cefp+5, 1, 5156, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.720169c40316bp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3d5bd8ecec462p+25, 6, 5158, {0x0p+0, 0x0p+0}},
+    {0x1.b18096b38aa73p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ce59d3bd4b9fcp-2, 12, 5160, {0x0p+0, 0x0p+0}},
+    {0x1.e03a74666735ep+41, 9, 5162, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9b39815fde2f9p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.87c73b3f28117p+17, 7, 5164, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fee98a31f8a0bp-2, 12, 5170, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9d962ca1cb557p+16, 7, 5172, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6491ed62b8b91p+16, 8, 5176, {0x0p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 5178, {0x0p+0, 0x0p+0}},
+    {0x1.c5eccadc97a6bp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e8c42e2151051p-2, 12, 5182, {0x0p+0, 0x0p+0}},
+    {0x1.fac68d5c26c4p+0, 0, 5184, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.34af966c2011ep+1, 11, 5186, {0x0p+0, 0x0p+0}},
+    {0x1.afdade67a9576p+24, 6, 5188, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.09d957bb010dep+17, 7, 5190, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.05855832563c7p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.325dd787bb3edp+17, 7, 5192, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5194, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eb6189967aa6p-2, 12, 5198, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0cef439776a5dp+1, 0, 5200, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.16a396c93a9d8p+17, 8, 5202, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.06d04b8a8208fp+11, 3, 5206, {0x0p+0, 0x0p+0}},
+    {0x1.0403dba42067p+11, 4, 5210, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.36e02158a3387p+2, 10, 5212, {0x0p+0, 0x0p+0}},
+    {0x1.6800b4a2b6d46p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c4526d3ce69eep+16, 8, 5214, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b11481929818dp+41, 9, 5216, {0x0p+0, 0x0p+0}},
+    {0x1.75004b7eb4c31p+11, 3, 5218, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.02fcf510effbp+1, 0, 5222, {0x0p+0, 0x0p+0}},
+    {0x1.09286a110a94fp+2, 10, 5224, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bffb73b897b93p+1, 11, 5226, {0x0p+0, 0x0p+0}},
+    {0x1.ff706247f8333p-2, 12, 5228, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0b9acd29c2e75p+10, 4, 5232, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.efe1d82df623ap+15, 2, 5234, {0x0p+0, 0x0p+0}},
+    {0x1.7da04b7ee6c68p+11, 3, 5236, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3176b394fb14ep+5, 1, 5238, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eaf04bc91320ap+11, 3, 5240, {0x0p+0, 0x0p+0}},
+    {0x1.7eb7ad9eabe36p+16, 8, 5242, {0x0p+0, 0x0p+0}},
+    {0x1.317b5917fdc2bp+5, 1, 5244, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.25204b882b046p+11, 3, 5250, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.be00b480355c3p+7, 5, 5254, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0c619d2e2851p+1, 11, 5256, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bfb9d969550d1p+3, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.066825d348a0bp+12, 3, 5258, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c6f7b13761623p+14, 2, 5260, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3a1028318fecep+17, 7, 5262, {0x0p+0, 0x0p+0}},
+    {0x1.f688d6225dcb9p-2, 12, 5266, {0x0p+0, 0x0p+0}},
+    {0x1.e8f1dcad06b07p+10, 4, 5268, {0x0p+0, 0x0p+0}},
+    {0x1.94812d8f8943ep+9, 3, 5270, {0x0p+0, 0x0p+0}},
+    {0x1.c543e8f3764f3p+1, 11, 5272, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dc13add359308p+16, 8, 5274, {0x0p+0, 0x0p+0}},
+    {0x1.535da521d6ad6p+41, 9, 5276, {0x0p+0, 0x0p+0}},
+    {0x1.2138775e5e8b9p+2, 10, 5278, {0x0p+0, 0x0p+0}},
+    {0x1.ae07d7de45ed9p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2780343cc9617p+2, 10, 5280, {0x0p+0, 0x0p+0}},
+    {0x1.90b221fd0c425p+17, 7, 5282, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d2a9d773a4ef9p+16, 7, 5284, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.129dd0d3458fap+1, 0, 5286, {0x0p+0, 0x0p+0}},
+    {0x1.98b1ae081c6a3p+16, 8, 5288, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2202c17a1bd8ap+11, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2d50e2beebb39p+17, 7, 5290, {0x0p+0, 0x0p+0}},
+    {0x1.8afb87fbf126bp+5, 1, 5292, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c4dd9b4250a94p+16, 7, 5294, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.07b40f976324fp+2, 10, 5298, {0x0p+0, 0x0p+0}},
+    {0x1.6ee04b6d3e3edp+11, 3, 5300, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.20e995666fb0bp+10, 4, 4236, {0x0p+0, 0x0p+0}},
+    {0x1.415058038ac9cp+42, 9, 5304, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.15f55423b5b8dp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.17d82ae21148p+2, 10, 5306, {0x0p+0, 0x0p+0}},
+    {0x1.3e5310ca8399bp+23, 6, 5308, {0x0p+0, 0x0p+0}},
+    {0x1.e38ad9a2d6bb8p-2, 12, 5310, {0x0p+0, 0x0p+0}},
+    {0x1.7aa8d80d1b07cp+15, 2, 5312, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7246802b5b88fp+17, 7, 5314, {0x0p+0, 0x0p+0}},
+    {0x1.640a619f000a1p+10, 4, 5316, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a860970773893p+10, 3, 5318, {0x0p+0, 0x0p+0}},
+    {0x1.5e3256bf6dd6ep+17, 8, 5320, {0x0p+0, 0x0p+0}},
+    {0x1.0f00b49133f6p+7, 5, 5322, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2ec04b7e93719p+11, 3, 5324, {0x0p+0, 0x0p+0}},
+    {0x1.3400b4a01dd0bp+7, 5, 5326, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ed34713d1516ap-2, 12, 5328, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f000b4ac9295cp+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.47b04b812301ep+11, 3, 5330, {0x0p+0, 0x0p+0}},
+    {0x1.3dd246c05302cp+42, 9, 5332, {0x0p+0, 0x0p+0}},
+    {0x1.5c54804b84cc4p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1932b4bf5505ap+25, 6, 5334, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.343720abd4c3ap+1, 0, 5338, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fce87069d5426p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8b6ec10ead44dp+1, 11, 5342, {0x0p+0, 0x0p+0}},
+    {0x1.7117fe7e6f2abp+17, 7, 5344, {0x0p+0, 0x0p+0}},
+    {0x1.08a0d7dba843p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c14dc0817b8eap+24, 6, 5346, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e569f5f7058b8p-2, 12, 5348, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa00b4ba42dc6p+7, 5, 5350, {0x0p+0, 0x0p+0}},
+    {0x1.109c1e31261edp+2, 10, 5352, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3fd3953e9b846p+9, 4, 5356, {0x0p+0, 0x0p+0}},
+    {0x1.8f1ffc1fa8cbap+1, 11, 5358, {0x0p+0, 0x0p+0}},
+    {0x1.f19cb157b67a4p-2, 12, 5362, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0afa20cac1052p+2, 10, 5368, {0x0p+0, 0x0p+0}},
+    {0x1.bc6c4d19984ddp+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.679f1283acd12p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.12571cbbc595p+1, 0, 5372, {0x0p+0, 0x0p+0}},
+    {0x1.06d04b8a8208fp+11, 3, 4782, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3c770422be43bp+24, 6, 5374, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.008dd5ef99fc6p+43, 9, 5376, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a9ca28dd8d20cp+1, 11, 5378, {0x0p+0, 0x0p+0}},
+    {0x1.82d7edc3b5ae9p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.885a1d18ad57cp+10, 4, 5382, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2d00b49042276p+7, 5, 5384, {0x0p+0, 0x0p+0}},
+    {0x1.0ab0d7c217d75p+1, 0, 5388, {0x0p+0, 0x0p+0}},
+    {0x1.96a0971327c44p+10, 3, 5390, {0x0p+0, 0x0p+0}},
+    {0x1.73f178de11daep+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.476bffe3a1b8cp+43, 9, 5392, {0x0p+0, 0x0p+0}},
+    {0x1.cfb00096b24c1p+1, 11, 5396, {0x0p+0, 0x0p+0}},
+    {0x1.ceef19e205815p+1, 11, 5398, {0x0p+0, 0x0p+0}},
+    {0x1.2d1fa8c3acc8ap+6, 1, 5400, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4700b4a8b4b7dp+7, 5, 5402, {0x0p+0, 0x0p+0}},
+    {0x1.107f77ebfb28ap+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3f9c329f7f75bp+24, 6, 5404, {0x0p+0, 0x0p+0}},
+    {0x1.e5c4115bac55dp+0, 0, 5406, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fde096f057458p+10, 3, 5412, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3501d7b0a0e66p+15, 2, 5414, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b3ab299ed5a83p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b96bab9a1da3dp+1, 11, 5416, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2e1489ecffbd3p+10, 4, 5418, {0x0p+0, 0x0p+0}},
+    {0x1.9a01690affbb4p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.11005a278f8cbp+8, 5, 5420, {0x0p+0, 0x0p+0}},
+    {0x1.889aed641727bp+16, 8, 5422, {0x0p+0, 0x0p+0}},
+    {0x1.67e6b6e2868b9p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5aa259814c876p+42, 9, 5424, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ea016a0524372p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.13456e2cc5186p+16, 8, 5428, {0x0p+0, 0x0p+0}},
+    {0x1.e2604b508cedap+11, 3, 5432, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2cf2df7dd9422p+41, 9, 5434, {0x0p+0, 0x0p+0}},
+    {0x1.ef336a6d444b9p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.18ae406cb11a5p+1, 0, 5436, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b20168b78ddcp+6, 5, 5438, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.56ef5e0fb7226p+17, 7, 5440, {0x0p+0, 0x0p+0}},
+    {0x1.9b289d7929e19p+5, 1, 5442, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8fa8f57eeec0fp+24, 6, 5444, {0x0p+0, 0x0p+0}},
+    {0x1.10399c81d22a4p+1, 0, 5450, {0x0p+0, 0x0p+0}},
+    {0x1.05855832563c7p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.35619b37e6a09p+42, 9, 5452, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0d8fa723c4bf2p+1, 0, 5454, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4eb3b5539b0d2p+10, 4, 5456, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cd62288bd094ep-2, 12, 5462, {0x0p+0, 0x0p+0}},
+    {0x1.ba750c8bbc786p+1, 11, 5464, {0x0p+0, 0x0p+0}},
+    {0x1.dbf4381b1a4p+1, 11, 5466, {0x0p+0, 0x0p+0}},
+    {0x1.7c37be045b3d2p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8778d802e93dbp+15, 2, 5468, {0x0p+0, 0x0p+0}},
+    {0x1.1e398ff9d792fp+1, 0, 5472, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2d3a7a1512097p+43, 9, 5474, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.799ffed4c79e4p+24, 6, 5476, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b1b5884db7cc5p+1, 11, 5478, {0x0p+0, 0x0p+0}},
+    {0x1.e63ba7f76020dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0314eefbba5f4p+24, 6, 5480, {0x0p+0, 0x0p+0}},
+    {0x1.d5f04b4b5d1d7p+11, 3, 5482, {0x0p+0, 0x0p+0}},
+    {0x1.5a59c6eb43f56p+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.4d84d85b8f194p+15, 2, 5484, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.571217dbb03eap+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1eabd6c6fa032p+17, 8, 5486, {0x0p+0, 0x0p+0}},
+    {0x1.03aaa1fe6a5fbp+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d6a37f19fc754p-2, 12, 5488, {0x0p+0, 0x0p+0}},
+    {0x1.3f54df682b024p+5, 1, 5490, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0a7beeece7322p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.fcbe2d979d16ep+16, 8, 5492, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.649d266973236p+17, 7, 5494, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2e0957bdd202dp+1, 0, 5498, {0x0p+0, 0x0p+0}},
+    {0x1.af4096f85ebd2p+10, 3, 5500, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.25c8825a9bbbdp+2, 10, 5504, {0x0p+0, 0x0p+0}},
+    {0x1.1f13670c15872p+24, 6, 5508, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6ec4d80125c28p+15, 2, 5510, {0x0p+0, 0x0p+0}},
+    {0x1.7a358d15985d5p+17, 7, 5512, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa516a69de90fp+24, 6, 5514, {0x0p+0, 0x0p+0}},
+    {0x1.551cad9431ff6p+41, 9, 5516, {0x0p+0, 0x0p+0}},
+    {0x1.0535edb2dea7p+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0559d2d109c37p+2, 10, 5518, {0x0p+0, 0x0p+0}},
+    {0x1.10f71381005bap+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.07f2a2b8b0925p+24, 6, 5520, {0x0p+0, 0x0p+0}},
+    {0x1.649d266973236p+17, 7, 5522, {0x0p+0, 0x0p+0}},
+    {0x1.aa8d36e9e736ap+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1d3297d82998fp+17, 7, 5524, {0x0p+0, 0x0p+0}},
+    {0x1.d7f9adc1d4232p+16, 8, 5528, {0x0p+0, 0x0p+0}},
+    {0x1.f8599b961ff25p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bfcdafa1d6ed7p-2, 12, 5530, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.347c36d544031p+17, 8, 5534, {0x0p+0, 0x0p+0}},
+    {0x1.30b08c6bebd3cp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b0dc19bae8798p-2, 12, 5536, {0x0p+0, 0x0p+0}},
+    {0x1.5b256d935c06fp+16, 8, 5538, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.089f077b6002fp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bb75ad6f71ce7p+16, 8, 5544, {0x0p+0, 0x0p+0}},
+    {0x1.6c9e061353108p+24, 6, 5546, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ec66ba1080c43p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0e3e10eff532p+1, 0, 5548, {0x0p+0, 0x0p+0}},
+    {0x1.ed64c25665598p+0, 0, 5554, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.da4bb06f12d8p+14, 2, 5556, {0x0p+0, 0x0p+0}},
+    {0x1.179eb1fa704dbp+2, 10, 5558, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a1ef7281967acp+1, 11, 5560, {0x0p+0, 0x0p+0}},
+    {0x1.7cf1dc2ca5ddp+24, 6, 5562, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4c9e1d474f0c1p+10, 4, 5566, {0x0p+0, 0x0p+0}},
+    {0x1.169df78b913cdp+2, 10, 5568, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.25ca7385a9774p+10, 4, 5570, {0x0p+0, 0x0p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 5572, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.362bf10642364p+10, 4, 5574, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a6c1ad740ad1fp+16, 8, 5138, {0x0p+0, 0x0p+0}},
+    {0x1.10bde852fb412p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1db68f4ad132cp+10, 4, 5576, {0x0p+0, 0x0p+0}},
+    {0x1.d268adb4b1f9ap+16, 8, 5580, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.12ccf944d631p+2, 10, 5582, {0x0p+0, 0x0p+0}},
+    {0x1.65ab354786a75p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e6604b63024aap+11, 3, 5586, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f70c794a07a0fp-2, 12, 5588, {0x0p+0, 0x0p+0}},
+    {0x1.121089bbf1ab2p+2, 10, 5592, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d4c1649252776p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.dd2fb0dde70c3p+14, 2, 5594, {0x0p+0, 0x0p+0}},
+    {0x1.10fa407d0dd53p+2, 11, 5596, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4987ec3198a0bp+16, 2, 5598, {0x0p+0, 0x0p+0}},
+    {0x1.60c0e859efb5ep+41, 9, 5602, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1524b2ab78ea6p+2, 11, 5604, {0x0p+0, 0x0p+0}},
+    {0x1.feb57b08434dfp+0, 0, 5606, {0x0p+0, 0x0p+0}},
+    {0x1.80a5f62eb9a84p+10, 4, 5612, {0x0p+0, 0x0p+0}},
+    {0x1.07f04b934cc68p+11, 3, 5614, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2a535e2fb6ea2p+9, 4, 5616, {0x0p+0, 0x0p+0}},
+    {0x1.bdb8c1b49570bp+0, 11, 5618, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6e13f6f77d3e9p+17, 8, 5620, {0x0p+0, 0x0p+0}},
+    {0x1.248e76a9907e4p+24, 6, 5622, {0x0p+0, 0x0p+0}},
+    {0x1.d8f0e708ff46ep+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3d67e8399a5b4p+1, 0, 5628, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a9ef012dc8bbp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f002d38684d41p+5, 5, 5630, {0x0p+0, 0x0p+0}},
+    {0x1.2ade01f55ef0ep+10, 4, 5632, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.03efc8cb0d6f2p+2, 10, 5634, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.291f868850e03p+17, 7, 5636, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.16a396c93a9d8p+17, 8, 5638, {0x0p+0, 0x0p+0}},
+    {0x1.077910a75f5d3p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.02d7cf6724289p+1, 0, 5640, {0x0p+0, 0x0p+0}},
+    {0x1.e980e6c0d10eep+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b0af0c08b45efp+10, 4, 5642, {0x0p+0, 0x0p+0}},
+    {0x1.e52ea0032eed9p-2, 12, 5644, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ad48da21ada49p+1, 11, 5646, {0x0p+0, 0x0p+0}},
+    {0x1.3cc65a0feaf76p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1e5733846e7fcp+2, 10, 5648, {0x0p+0, 0x0p+0}},
+    {0x1.e29ab7be659f1p-2, 12, 5650, {0x0p+0, 0x0p+0}},
+    {0x1.0dd8f11a4d83fp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a4d189050d1c9p+9, 4, 5652, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bcf2ed5d76d48p+16, 8, 5654, {0x0p+0, 0x0p+0}},
+    {0x1.0522e004d474dp+6, 1, 5656, {0x0p+0, 0x0p+0}},
+    {0x1.0e1816d7c732fp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f8607f48f41fcp+42, 9, 5658, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.15e46acde94acp+1, 0, 5660, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cee6cf311254fp+1, 11, 5174, {0x0p+0, 0x0p+0}},
+    {0x1.3096e9cb16806p+2, 10, 5662, {0x0p+0, 0x0p+0}},
+    {0x1.bc57fb206f956p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0584b33c5c804p+1, 0, 5666, {0x0p+0, 0x0p+0}},
+    {0x1.2d97adaded7bbp+2, 10, 5668, {0x0p+0, 0x0p+0}},
+    {0x1.3600b4a4a5b7ep+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.09b83e010fc01p+10, 4, 5674, {0x0p+0, 0x0p+0}},
+    {0x1.185a7f1ced624p+2, 10, 5676, {0x0p+0, 0x0p+0}},
+    {0x1.032c22ba60107p+2, 10, 5678, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.081b35b278964p+25, 6, 5680, {0x0p+0, 0x0p+0}},
+    {0x1.5ea355fa73ca5p+0, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.619e7d233f7e4p+42, 9, 5682, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.27b7cef874d2bp+2, 10, 5688, {0x0p+0, 0x0p+0}},
+    {0x1.ebd35f7c0d05ap+4, 1, 5690, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.122a67c543a17p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e7b3d2f2b1adfp-2, 12, 5692, {0x0p+0, 0x0p+0}},
+    {0x1.2470241b51ea5p+10, 4, 5694, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.23b7fcaf036c4p+10, 4, 5696, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d51c01e2c24c2p+1, 11, 5698, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a0412efb66f75p+9, 3, 5702, {0x0p+0, 0x0p+0}},
+    {0x1.0045e7f7caabp+17, 7, 5704, {0x0p+0, 0x0p+0}},
+    {0x1.1d5253c529d71p+3, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8b70e88adb704p+24, 6, 5706, {0x0p+0, 0x0p+0}},
+    {0x1.756cc50716acap+4, 1, 5708, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a1104b6c9b13fp+11, 3, 5712, {0x0p+0, 0x0p+0}},
+    {0x1.2d20977acc58ep+10, 3, 5716, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a8c83c27ba52ep+0, 11, 5718, {0x0p+0, 0x0p+0}},
+    {0x1.43543c76e9edcp+4, 1, 5720, {0x0p+0, 0x0p+0}},
+    {0x1.760656c9c1aabp+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ea5532aae43eap-2, 12, 5722, {0x0p+0, 0x0p+0}},
+    {0x1.0b00b48824279p+7, 5, 5724, {0x0p+0, 0x0p+0}},
+    {0x1.3705d86dc9034p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e905d2d899658p+0, 0, 5726, {0x0p+0, 0x0p+0}},
+    {0x1.ca0a8067f848bp-2, 12, 5728, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1c20d84f454dbp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5730, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4bffa963e134p+5, 1, 5732, {0x0p+0, 0x0p+0}},
+    {0x1.d6b4adee78101p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.059c58d8d99eap+1, 0, 5734, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fcad73fca1154p+10, 4, 5736, {0x0p+0, 0x0p+0}},
+    {0x1.0ff7fa602215ep+2, 10, 5738, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f2a1ccdc4f436p-2, 12, 5266, {0x0p+0, 0x0p+0}},
+    {0x1.8bd0611a10777p+44, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.26f8259a8473bp+12, 3, 5744, {0x0p+0, 0x0p+0}},
+    {0x1.25a436d098acp+17, 8, 5746, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.43e4a89a6b505p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f7449f4c17b3cp-2, 12, 5748, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6e27e18966426p+2, 10, 5750, {0x0p+0, 0x0p+0}},
+    {0x1.011af7de8c3b1p+1, 0, 5442, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aed44983d937p+24, 6, 5752, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.299e239e985e5p+2, 10, 5754, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.29a4fe49c823ep+24, 6, 5758, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1a00b487ab404p+7, 5, 5762, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a30836b677cd2p+17, 8, 5766, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.94b49543944f2p+5, 1, 5770, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.29797d364474ap+10, 4, 5772, {0x0p+0, 0x0p+0}},
+    {0x1.0b3696bd1599bp+17, 8, 5776, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.441c2c524a6c9p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8558543758bcap+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.772387544011p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2fd04b6fad17bp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.579818109bc6dp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ec2da9cd5c3fep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2cfcb8bf83babp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.70f3595d5c643p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e609aa13b78bap+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.20d78410c963bp+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5eac23e2d576ep+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1fef34399285ep+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.364c6c00671c3p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d906b8c72036p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.552d24c3228adp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.087d82da0eeb1p+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.00d2409b853fdp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a46096f4fe2c3p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0cca763dcbed4p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.33db1339ecb18p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.940168fd68059p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa00b4ba42dc6p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.15b7442ce4f0fp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e4161dd886376p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.04a2cf30b2f84p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.65c0b6c5a3805p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.410261576d79bp+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9cb32b48ae38ap+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.001b56f2a0909p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3b412df2f4881p+9, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a0f816a3f2e79p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.669806bc9e5a2p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7418a37dc75dp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.11af6c1147dccp+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dce839b1cef18p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.27fe5742cb522p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d25a87b4939adp-1, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c88385ba210b4p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0b005a5ee032p+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a2a991981039ep+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bdd795081d8ep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e32b0b47435d7p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6100b49eb31abp+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7c724864ac3b5p+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d734987320577p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0ebb2ce0b2d26p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.db334f1325ed2p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b3ad04a3654d2p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5ba04b806d648p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8e31cbf29ff9bp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.19bb8e578014bp+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3b98a4df2102bp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c26096d29b43ap+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ecba4a135609bp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a9eb0178ce314p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0e2dddfed567cp+11, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e686df676199fp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c7ff57efe0b5dp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2a904b89db4cep+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.08adec0c2d365p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.ffe096eb2b068p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e66e5b746e5c5p+15, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a4e06ddb13dd3p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8d8a5211f01dcp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ba31a03967bccp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.61c62c7710918p+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3df613b93e67dp+44, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7700972a71439p+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7bb04b6ddc07ep+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bf3f82ec629f7p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1713154325aa1p+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2a54301143069p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1338c944162fdp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.eb626d6275692p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8bd3c40634781p+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0987ed28a0426p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2f9fd85e005dfp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e50f03a39855cp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.209c3385df0c4p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bca4bb0d4ba11p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d0928513032e3p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e78e76caf563p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7f7938e09754ep+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bc8c4e7254976p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e2b85bc3f9caep+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.181212fa56c89p+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.34805a8935ebap+8, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.42a8ad9c63d5bp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1b204b853a646p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5400b4a3b3e94p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c82dd840ae2f7p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e19283c177854p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c0752359bc82dp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ebdbc7769666fp+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b750f8dcefcdbp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.65666dc76fdd6p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e2acb427425bfp+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c2904bbf2f5b5p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3de3c85a38478p+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.01a04b912c8d1p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.afdcede39238dp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.238dd67f5ae4p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.09880488d3795p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.00d410a31b632p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.489cdae7338d9p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.28cecadd25cf1p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.22005a49c4346p+8, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.49823a6782e11p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.702bc7576ee86p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.dbc217151889fp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c0d7099be15c6p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.44be933438dc3p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7385b6f5cfc4ap+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4567ec0c741f7p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5338f790460a4p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3300b49dd9dd1p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dd523f99d788p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.aec1b10a81245p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a3b04b7c51d46p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d53ad75a092abp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.863ce10dedaa1p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e094ebab419e9p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a3cd6d58bd72p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2872d81e09492p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.253825f00e22cp+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4a2dd8584efcap+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e6c096ca09acp+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7eb81a02eff3ap+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.619e7d233f7e4p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d6ea43e7cae4dp+41, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.de2fd829f0c0dp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.19bc0fd44faap+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.535888b784fccp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.898c51e719abbp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.5e5a0499ffdb6p+3, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a7894104a9ed1p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6e0168a751dc6p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.db910b401551ep+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3acbd6d968af9p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f31dfaa03aa2ap-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.62804b7fbf85fp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ef40973945b52p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.581b3e49d8935p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1e80a5001e0fap+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.458ee043ffe46p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e9add294bfa4p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.eb0f9c968c83bp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ee3bd82a98db3p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0ddae99913143p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.05504b76fbf64p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9474f6eb37afcp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2021b72ad628bp+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0e4f4fb7261ebp+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.511d1218cb64ep+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.9e8e5a807d7f1p+15, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e8204b80b0079p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4ce63efac21b4p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.00f38702aa798p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.cabcf40153d5fp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8fc0d83bac95ap+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0a7beeece7322p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3f3f396497d5fp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2d1fa8c3acc8ap+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6cd5d60920581p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3b7d0a7f08c0bp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.98e036af5a1a2p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.aa01692f3ef5p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d92ebf71a0b05p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.83a5d817e0e89p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3c12efec9f698p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.20569b866b293p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6eb9ed8af33ffp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.deb4692a339a1p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.06f0deace81f3p+2, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3e6c753b4c935p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.97f4d7fb53652p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.16004b7861376p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b27d9837885fep+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0c586d20317c6p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7ee72dd9f5ff2p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1a0168fca758ep+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.59956d5a3a5d7p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c200b489452aap+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2d33deccf49d2p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f978ebc8bd45p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f73312bb539d9p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.13456e2cc5186p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.202fadd427109p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e50aef8446ffap-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9b8b147977fddp+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ffaea4c0161fep-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.35f5a6cec24f9p+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.07ed48cca5cb1p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9840971e412d6p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3015ac208f6d5p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.26078fd35c3cdp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cc672db47791dp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4f2b4eaab5b51p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f31dfaa03aa2ap-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.df8b0c52932fep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.36406c1aaf9cp+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e53431d3c271p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.47f439d4bcc77p+11, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0adf6bdcc68d5p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b3bf20ae2fa97p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.08995f3d39609p+11, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.430e697af9716p+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0e04ad289e2abp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.64b2f66a51411p+3, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.06747ad7b9ac2p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.22d8ea12b8b09p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b846edcddfab7p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5fb04b9c2ceb6p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0913b6c2ca8c4p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4ffc6bf232dfap+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f30096d75c505p+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c216d83948685p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8f2096c556ed6p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b11512d812f5dp+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0bc521e5051efp+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5652decf03c64p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.434cd883aadf9p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d8905b174bf49p+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.96968bf1a1215p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1f00b492ff025p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.702acfcec0898p+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f92fb0183fb8ap+14, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0cabec0f8fc72p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.789b7af8abc8bp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ed32ae4cc4dadp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.fd38cbc470487p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ab4096e5e9602p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e56bf362c034p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03c025a21ef05p+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1cb04b8e3d1a7p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.107c828e84005p+18, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5eb56ed051339p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4a2f99e9f6843p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.6a5c9de005ac6p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cfd28b58dfb41p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.7a711c79a512fp+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c41bfb7323489p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.04ab41c255c71p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.32d828ca0acb2p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0110e5036fed7p-1, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.101f6942fa089p+44, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.75104b6b3112p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.47d770804234dp+11, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a6a850000a883p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.492c003d2c8cap+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6477ebe58f325p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fcc05d25ffae8p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fee0d82e59e83p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.67a56d4a9c14cp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e4444e34a0b7cp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.feff44d85ba19p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.048c394a3fc35p+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e32b0b47435d7p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0d07b35ab2683p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d986230d24be9p+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3b7e3a422acb8p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dc13add359308p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0dd8fe6e4962ap+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4c85b2c781028p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8400b486a0e0ap+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.948a6c0ddbe69p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.071706f229dc7p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.68794f9c5b778p+4, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d7f9adc1d4232p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.cea4b79aab2cbp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3c00b46d55129p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.079fab7482333p+18, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.888ec4ce4977bp+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1203af9e52a77p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d53b99eac5ecfp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d60169091c1ep+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.08805a144df6p+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.11712cfabb9d9p+2, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3a56ebf7ded34p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3e3dd7c1b7847p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0f8d20007afp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9c2017c8429d1p+41, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.191e884250dfcp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c926da97d3f2ap-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03a03ec0b6a41p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.42a8ad9c63d5bp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a00169189770fp+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2f02925e2022dp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bc7a45f478d4ep+3, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.cf45b802ea8f5p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ce10b5039eec3p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1fb179296bc0bp+44, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.dce06380c5bc9p+3, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6500b4a7c2e93p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.959e7e9b3bcb3p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.978495f621aaep+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.decaff2ebdbdep+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0ac02d7fe23f6p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1c0169012f402p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3000b4970e023p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e0788071811bap+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0eac72db012e4p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9998edaf0992ep+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9fd24a07af6bap+46, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3550a903b5ffcp+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c76e119c68fc5p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d3d1bc2203774p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ca97714db2fcp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0e00b4b1642fep+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.17eeafdadf8d7p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.79c576b8f0bcep+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d9d4d304d60cp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3800b4a92d9f2p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.32bce651a3b6cp+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.cc1b2225ee674p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a9701f05db44cp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.23754179911e7p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.45b29b77db1e7p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.377cb544a7c25p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.fb35ff3defa0bp+0, 0, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8f92708925ee8p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7c4a60bca7502p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3015ac208f6d5p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ca72297fa262bp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.aae503f290a39p+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.576dd17088d9bp+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.cf885384f73e4p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2e75190ce3cfp+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f19cb157b67a4p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3dba2ddc46316p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2f68c9850efdbp+44, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bda3a3a1ad53fp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2ade01f55ef0ep+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1205f75d92ce1p+11, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2e19fe95208cbp+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7bcb00b03a35dp+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.6201a82b7c7edp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e3feb342e9245p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a8536bcbd9bc7p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3f1f5b0dd1e5fp+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.779ca85c14cd7p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.787dea5178f7p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa952f010c1d1p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.82304b80271ep+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.3918d7fe191ddp+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.66e04b65215fdp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.93b35a322a2c7p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.dd88c7860ed8cp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2a4ca5ba51216p+3, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f7085b0b8839ap+15, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3596b4bcf332p+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f671ad73d6c07p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.95f5a7465996p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c401696a25b2ep+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bcb8dfbcc0d56p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c1ae379f90d59p+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2e19ebf5508e7p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7c48d49f6cc18p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c106ad5b77241p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d1a0adda5accap+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e92d5a0f95068p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d0e16bac9989ap+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.4e94be2e19b87p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6136d88ae366ap+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.17427e298ebcep+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a41df366ad016p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.109d44ea00e6ap+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bcd67b7ca7c73p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2971e6b453871p+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b6f756fa1f9a8p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.77d79befec255p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3c00b4a9a0623p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.85ce4a5135527p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.24198360bd6fap+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2b7ca13fae4e7p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.21fd4837999f2p+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0b36e6e8e9fcfp+11, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d957e54ae7f76p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7d4cb49707e41p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e1f04b82bd347p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c6e08e5496312p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.331825e478de7p+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4f00b49860273p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0a005a28edfa3p+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.abe096cf97971p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.63db7126b0d23p+2, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.10fbb5013ca1ap+26, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.19189b585659fp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ada04bbdfaeep+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1705134f6a947p+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.093cd0e4e3b09p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c4387d70bbc58p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.98e036af5a1a2p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1d444474f8408p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24e465a8be205p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3edfeda0d2a0fp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.74dcaf606ae31p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.09413d0d07cfcp+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e8d9dd9074bfp+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b7ea290a6a196p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2ad53ff06a7a9p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f69169750c8cfp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24805a0ed4402p+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1ee0966835c9dp+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7b1910083b684p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a292114694058p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b1fb34270e7eep+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.10404b81d9d37p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.35f06d03cddd8p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.76f4d7c98f676p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.c809c356056fep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.70e7c5d570d59p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1e0e4b9ac8916p+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f663aff1c6d66p+0, 0, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.44429cf3bfb4fp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d098313531148p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1bb4ccfa7b0d7p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8a6a0dcbd0343p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.bbf6d3b4311dp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.170bd5509087fp+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.50cf4e29d8a1ap+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ba8b0b1e23a6cp+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c7c45b687f781p+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.12904b7184afep+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.82e0daef9abc5p+40, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e2bdc93d433d6p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ebb45100fb717p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e8f8d82cffae2p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a60262c4979fp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e6e8d83bba0d4p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.52b86c7b9dac7p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e816868fbffap+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cd62288bd094ep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dc016916b3d3ap+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.36f7836822176p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1900b4a7db7a2p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.11226c47fa56p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ca016977bd689p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a0851b3f1d8e1p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c801697335816p+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.33d025a27a9e3p+12, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c9c4a969b1eaap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b2ca1d466e73dp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.61ba1ac964423p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e14d9bf8557d9p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.00ddcfe8e7249p+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6af4959c88a5cp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9a792f1965712p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2c61b8d7c392ap+40, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.56db3b83e2053p+11, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1e104b89c8404p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.650c2f0bc9027p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.24bfd7b4ddb06p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a6ca0918ec8a6p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5500b494bdc62p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0781aaae003bbp+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ec25eb9edc4dep+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0c44575de04bp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.16f94c4e3d8bdp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.484f796f0faedp+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bb69e8f6a723bp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4b005a2124083p+8, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6a59aa23d09e9p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.414f2527ae803p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ea9093de411dep-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5c0703defa124p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.42a04b80474b4p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b57653782fc3fp+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9d47368108c49p+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.283d153609da7p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4c75d88086efcp+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cfec307778ea4p+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ae17b261a8406p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.66c096bb7328p+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3e0cd7c5f7896p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3c00b498664b7p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1b46fc9b36b0cp+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fbb0888f66061p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2ae9d7e51b5bdp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d459479265c33p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f5b7285daaeb7p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a20096eda2385p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.49536a68c38d3p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ab5350be8eaa2p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a576cd1776968p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c74bd8369f7e6p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.abcfe20e3dc46p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c44c2d7c29f2cp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3e540a85a4843p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.1194fa78faf07p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1a3025d574291p+12, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a69af92e73f01p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a345ec1e07892p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f425d700376bap+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.191e884250dfcp+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a292114694058p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1d18f08b07869p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b1bcec3e3cfedp+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.cdcd1aaa0ec6dp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d62bdc8b4064ep+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b59c76b90ee63p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6d4ec68985dap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.03aaa1fe6a5fbp+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b4104b6ddefcbp+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.07e31f97d42c3p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.23b04b8a892b7p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a801692ab70ddp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5b5208f199703p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d386d2f372757p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e379a7c542f6cp+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.72b03568eafc6p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.fc166f3d15813p+23, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7d904ba0d1652p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.20d78410c963bp+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.db809702238bbp+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6e43b0a0a0d18p+14, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.cabcf40153d5fp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0507132df7d19p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.3a5516c23d499p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.459ec1d0e7dffp+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2900b4a9a6867p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c78154c073906p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2c1964a97491dp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.74f7736626cf1p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.169f93468edd3p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.25d962410d9f7p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.13085c52248ecp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f7204ba91a495p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.49cb4ede5b304p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.176afa43a241bp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.97175985897dcp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b693ada4b267fp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9f45b70016941p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.06a88887f7d8cp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.10704b8f5163ap+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4b9b101055daap+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5059b4ec3c389p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.86d04ba3e5bf1p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a359836cfc8dfp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5e9f71a257bcdp+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.214ea63220176p+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5adb8b916449dp+6, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.d296f01e9cb44p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c77e96ca9023fp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2b2b31ce26af8p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b4db26875bdaap+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c6be6beedd1e7p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0cdd0e2405844p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9f85c58d9544ap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.67a56d4a9c14cp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e15ca1b5c6abdp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f78e70cf4e32cp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e8fc343b06f2p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b4104b6ddefcbp+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.16a35ad87c31dp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a752d824f2ac9p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.aacb432b4d155p+23, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.171ba641cc5fbp+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.48e8ad7803dc9p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0c6f6bf976996p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.4efbc5963c1ep+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.cc1b2225ee674p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a6901b00f89bcp+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1c147cc1b35f4p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.37ad0a89c4f2fp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.88562e0a2e843p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1474649a3b3dap+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7cc32ed5020a7p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.b4c52da0b9894p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7a10aac36c93ep+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9da2ebfb524eap+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.50036d7917b3fp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.017f9ce035351p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f61a2d8c97d1cp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.075f2885dbf92p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9e0169140f89bp+6, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.27e1d8179600bp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.669127959c468p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.48c9a35b197f7p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.25204b79c416ep+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bfa1cce24aebdp+41, 9, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.10f04b74d2344p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.231f8f6b82a31p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ccf999a0e5d5fp+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1ac40f2e4ce11p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e11df044b365ap-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ace31c3a749edp+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.df18c1bd14545p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7c26d82a3ca1fp+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d65f1d7fb45d4p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.18cd7632bc697p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d53b99eac5ecfp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.394cd8311efbfp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d399e6e2736d8p+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.031a62e560d85p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0b2dace49a0c3p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.382f16d7057c2p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8316a8353f61fp+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e73697a9d909dp+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f99a8958768efp+27, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.12ecd82ca9051p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2d0ba9d966dc3p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.82ddd6bb08b8fp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8624ca683a873p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.039f3a8adaad9p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.f754bc2ecede8p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.4e575b3e792e8p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ab00b4bc86dp+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bfb9d969550d1p+3, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.619d09a6f95e7p+44, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.03efbbfc2f66dp-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.09ebd69a64ceep+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d400b4b20c4bap+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1b81fb75380f7p+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3700b4a6e9ab8p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1f66f7c8e74b5p+44, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1ac58c04d68e5p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8ba20cdff4507p+12, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.fa7ea2cad0fbbp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4f7760f2d106cp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a40169ab77f55p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.888dc5e80bb1fp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.85151177dad7bp+46, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.6d470747fe288p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d67ae04330188p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c72e5b21679aap+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0cdc76ceea2afp+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.7f0c2f8b46996p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.d3ec18b1f3d4dp+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0debd7c7bbc58p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4081d7a03cf37p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.525e36e5bee67p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5700b49945ad5p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.22005a4e12ba1p+8, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.26b46d8e230a8p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f128450808e34p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.4f489fa5f1da8p+42, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0b6e72e2bfd6fp+12, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.619d09a6f95e7p+44, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.62804b7fbf85fp+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c1e04b58ff8e8p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b6d04b735c35ep+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.bbe2027d31a28p+16, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2461d0f6d840fp+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.10cd3a811f4dfp+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.e74d25c17378bp+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c7852db80ced8p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3ba3d7d1699f8p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.253498da123b2p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.311a808d8b8e9p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.12dd46453b787p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8f5bd83621692p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.892096e34297ep+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c1b614e616051p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.44cacada4e256p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.73f64b2bee6bap+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7900d6cf2fbfap+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bb116704a3a91p+0, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9364ea9870eb2p+41, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7c4e6bfca3792p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.28adc32a64841p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.120169fe2927ep+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.14ee6ded4cc1ep+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.ad466db27a1b7p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.03b211308061fp+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ab3dbc66178cap+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.45a096da3792p+10, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.16102576cec24p+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.02d46998a1ce7p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6a60d847b6be6p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1f09a69d8a7fbp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.35a07b733dee5p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8c604b908f4e3p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a0afebfbbc223p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.050b06f326cb4p-1, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d500b4d6c46cbp+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0d2b6d08c56f4p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.204b723b63eecp+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.16cdae0197b34p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.103cf73ecb49p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5b7ad7e567d8p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.0cc54ee125436p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e2604b508cedap+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.56e596c7c4344p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.195d7b4c911dap+4, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a3f5e49329df9p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ce016980cd37p+6, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bb11d80e93181p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4c204b80e93fap+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.b2c0eac6a6812p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.115a1c93f73fcp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.666336af5189ep+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.486eb449e5742p+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2a6f9a43fa1afp+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c5ceceb70046ap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.fb60dc965b3eap+15, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.954f28675cap+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.4300b49fa4e96p+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a8c83c27ba52ep+0, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1273179f9eec6p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0ea4a9ab2218cp+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.a900b4b7fee8dp+7, 5, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e69aefe133477p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.582815930620dp+43, 9, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.86924d1d0860cp+23, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.689cebffc029p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.16409777523c8p+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6c3bd852ae82ep+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.8a3da2948cbap+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2492d8554592ep+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ca4c8dc9923bfp-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c8af47ef63525p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.27ca952a4858ep+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.47a7c34875c9p+25, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5311d7e04e895p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.27685c53b20b3p+43, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5cb2c7ed97376p+1, 11, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.08f44b7062ebdp+18, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.72829de21f952p+0, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.370a2782f4637p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.c1017dca4a7d9p-1, 12, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0289de44fcb7p+1, 0, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.f801368659454p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.09bbabeb0d3bcp+18, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.d9fefc348e1f6p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.6b004b7bc4231p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dd53ff02f3519p-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.085747a3325acp+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c01ed81b5fd4bp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5952d7c98e94p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.38fbe0dd7030dp+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.595a941f9f331p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.caf6bf1e60f5bp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2709be4399f12p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a2ce6c0d781f3p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.d3604d20c1f68p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.92cdf8c60b42ap+42, 9, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.c9f585b8ecf15p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.66dd6d7044e7cp+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.10722b780c9aap+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.a84a85d94de14p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2856d6c484662p+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.b6a43cb677f19p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.dbf1440083061p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.89165ad0ae788p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.e19283c177854p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.4ca18fb1a1df4p+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.eca037ae63c9ap+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.7b47d83887d26p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7da317c1dc2d7p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.9d1b1634a85f5p+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f6858976d1282p+0, 0, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2d60d7e43a07fp+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.2c30e91068946p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.9a9f16bc79911p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.fdf04b1d83e77p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.99092def5b58ep+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0d91420f320c5p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0b0661ed3ba98p+6, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bb304b83f2d84p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.01499f400b0ddp+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2e63261b6f2f3p+2, 10, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e569f5f7058b8p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.2ca66c94c3e48p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3700b4a6e9ab8p+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3899ad80029e6p+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.0fe0a9c5f2becp+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a90063070cceap+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5c6c8e77c2ccdp+9, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.ac12334cfb3a8p+9, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6b0356c7c9726p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.25f723b5982dbp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.2f4cebe891e83p+16, 2, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.09a779e6fe086p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.bd72d2b4971d1p+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.8f9dbe69bc625p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.a402d5019b595p+5, 5, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.410fd7dc48723p+15, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.5a6fd85412329p+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.71d3928b93671p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ea25abf341d61p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.325dd787bb3edp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.2aa158bf96712p+12, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.495f16de9b3fcp+17, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.7c4cee06c360cp+16, 8, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.a5c5b0f770c87p+14, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6874bc1f581e1p+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.67c0975015c64p+10, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.aa7e5a914e787p+4, 1, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.bf23ee0590afp+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.471cae1dd3961p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.01c000db6ec82p+25, 6, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.b977cd955f79ep-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.1d3160114f31dp+2, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.34704b7a37992p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.6aa04b8c09cb4p+11, 3, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f4db6fe4080f2p-2, 12, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.3bb6d65b171cap+5, 1, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0a9af7a55d92ap+2, 10, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.553cede134968p+16, 8, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.c876c47d7cc44p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.295716daa15ap+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.e710c2ff32941p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.6108606296c4cp+17, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.204b723b63eecp+18, 7, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.ff1f2cc9085bep+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.016016cc935e9p+10, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.e69827795b94bp-2, 12, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.8298032416df6p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.3930b7cec32e3p+16, 7, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.1a904b88087c6p+11, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1cb025b5c8babp+12, 3, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.159c93b739527p+1, 0, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.f856658cb8bbbp+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.8cdf797db249fp+10, 4, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.0d67d7f17937ap+15, 2, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.dcf1408e51553p+10, 4, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.0381beb7278c4p+1, 11, 5778, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.516871c1fed07p+5, 1, 5780, {0x0p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1.6c276c0395269p+16, 2, 5780, {0x0p+0, 0x0p+0}},
+    {0x1.f1b7eaf9b642p+24, 6, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.5807331c2117cp+17, 7, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.74659c95fc6f4p+24, 6, 5778, {0x0p+0, 0x0p+0}},
+    {0x1.5b00b4a2557bdp+7, 5, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1.1bb796ccc977p+17, 8, 5780, {0x0p+0, 0x0p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {0x1p+0, -1, 0, {0x0p+0, 0x1p+0}},
+    {-0x1p+0, -1, 0, {0x1p+0, 0x0p+0}},
+};
+
+inline constexpr uint32_t roots[] = {
+    270,
+    474,
+    16,
+    18,
+    20,
+    62,
+    484,
+    64,
+    140,
+    284,
+    286,
+    22,
+    144,
+    146,
+    294,
+    502,
+    24,
+    150,
+    152,
+    70,
+    0,
+    2,
+    30,
+    310,
+    520,
+    78,
+    314,
+    4,
+    318,
+    166,
+    34,
+    6,
+    86,
+    174,
+    330,
+    38,
+    178,
+    180,
+    550,
+    552,
+    40,
+    556,
+    340,
+    92,
+    562,
+    344,
+    94,
+    348,
+    350,
+    188,
+    574,
+    576,
+    354,
+    580,
+    582,
+    190,
+    358,
+    192,
+    362,
+    194,
+    196,
+    368,
+    370,
+    372,
+    198,
+    200,
+    8,
+    204,
+    206,
+    384,
+    10,
+    210,
+    618,
+    212,
+    392,
+    394,
+    214,
+    100,
+    218,
+    102,
+    634,
+    46,
+    106,
+    226,
+    228,
+    412,
+    230,
+    232,
+    418,
+    420,
+    48,
+    424,
+    12,
+    112,
+    114,
+    664,
+    432,
+    242,
+    436,
+    244,
+    440,
+    246,
+    14,
+    936,
+    118,
+    448,
+    252,
+    452,
+    688,
+    690,
+    692,
+    454,
+    254,
+    120,
+    122,
+    260,
+    124,
+    126,
+    266,
+    54,
+};
+
+inline constexpr double vote_rest_min[] = {
+    -0x1.ep+6,
+    -0x1.dcp+6,
+    -0x1.d8p+6,
+    -0x1.d4p+6,
+    -0x1.dp+6,
+    -0x1.ccp+6,
+    -0x1.c8p+6,
+    -0x1.c4p+6,
+    -0x1.cp+6,
+    -0x1.bcp+6,
+    -0x1.b8p+6,
+    -0x1.b4p+6,
+    -0x1.bp+6,
+    -0x1.acp+6,
+    -0x1.a8p+6,
+    -0x1.a4p+6,
+    -0x1.ap+6,
+    -0x1.9cp+6,
+    -0x1.98p+6,
+    -0x1.94p+6,
+    -0x1.9p+6,
+    -0x1.8cp+6,
+    -0x1.88p+6,
+    -0x1.84p+6,
+    -0x1.8p+6,
+    -0x1.7cp+6,
+    -0x1.78p+6,
+    -0x1.74p+6,
+    -0x1.7p+6,
+    -0x1.6cp+6,
+    -0x1.68p+6,
+    -0x1.64p+6,
+    -0x1.6p+6,
+    -0x1.5cp+6,
+    -0x1.58p+6,
+    -0x1.54p+6,
+    -0x1.5p+6,
+    -0x1.4cp+6,
+    -0x1.48p+6,
+    -0x1.44p+6,
+    -0x1.4p+6,
+    -0x1.3cp+6,
+    -0x1.38p+6,
+    -0x1.34p+6,
+    -0x1.3p+6,
+    -0x1.2cp+6,
+    -0x1.28p+6,
+    -0x1.24p+6,
+    -0x1.2p+6,
+    -0x1.1cp+6,
+    -0x1.18p+6,
+    -0x1.14p+6,
+    -0x1.1p+6,
+    -0x1.0cp+6,
+    -0x1.08p+6,
+    -0x1.04p+6,
+    -0x1p+6,
+    -0x1.f8p+5,
+    -0x1.fp+5,
+    -0x1.e8p+5,
+    -0x1.ep+5,
+    -0x1.d8p+5,
+    -0x1.dp+5,
+    -0x1.c8p+5,
+    -0x1.cp+5,
+    -0x1.b8p+5,
+    -0x1.bp+5,
+    -0x1.a8p+5,
+    -0x1.ap+5,
+    -0x1.98p+5,
+    -0x1.9p+5,
+    -0x1.88p+5,
+    -0x1.8p+5,
+    -0x1.78p+5,
+    -0x1.7p+5,
+    -0x1.68p+5,
+    -0x1.6p+5,
+    -0x1.58p+5,
+    -0x1.5p+5,
+    -0x1.48p+5,
+    -0x1.4p+5,
+    -0x1.38p+5,
+    -0x1.3p+5,
+    -0x1.28p+5,
+    -0x1.2p+5,
+    -0x1.18p+5,
+    -0x1.1p+5,
+    -0x1.08p+5,
+    -0x1p+5,
+    -0x1.fp+4,
+    -0x1.ep+4,
+    -0x1.dp+4,
+    -0x1.cp+4,
+    -0x1.bp+4,
+    -0x1.ap+4,
+    -0x1.9p+4,
+    -0x1.8p+4,
+    -0x1.7p+4,
+    -0x1.6p+4,
+    -0x1.5p+4,
+    -0x1.4p+4,
+    -0x1.3p+4,
+    -0x1.2p+4,
+    -0x1.1p+4,
+    -0x1p+4,
+    -0x1.ep+3,
+    -0x1.cp+3,
+    -0x1.ap+3,
+    -0x1.8p+3,
+    -0x1.6p+3,
+    -0x1.4p+3,
+    -0x1.2p+3,
+    -0x1p+3,
+    -0x1.cp+2,
+    -0x1.8p+2,
+    -0x1.4p+2,
+    -0x1p+2,
+    -0x1.8p+1,
+    -0x1p+1,
+    -0x1p+0,
+    0x0p+0,
+};
+
+inline constexpr double vote_rest_max[] = {
+    0x1.ep+6,
+    0x1.dcp+6,
+    0x1.d8p+6,
+    0x1.d4p+6,
+    0x1.dp+6,
+    0x1.ccp+6,
+    0x1.c8p+6,
+    0x1.c4p+6,
+    0x1.cp+6,
+    0x1.bcp+6,
+    0x1.b8p+6,
+    0x1.b4p+6,
+    0x1.bp+6,
+    0x1.acp+6,
+    0x1.a8p+6,
+    0x1.a4p+6,
+    0x1.ap+6,
+    0x1.9cp+6,
+    0x1.98p+6,
+    0x1.94p+6,
+    0x1.9p+6,
+    0x1.8cp+6,
+    0x1.88p+6,
+    0x1.84p+6,
+    0x1.8p+6,
+    0x1.7cp+6,
+    0x1.78p+6,
+    0x1.74p+6,
+    0x1.7p+6,
+    0x1.6cp+6,
+    0x1.68p+6,
+    0x1.64p+6,
+    0x1.6p+6,
+    0x1.5cp+6,
+    0x1.58p+6,
+    0x1.54p+6,
+    0x1.5p+6,
+    0x1.4cp+6,
+    0x1.48p+6,
+    0x1.44p+6,
+    0x1.4p+6,
+    0x1.3cp+6,
+    0x1.38p+6,
+    0x1.34p+6,
+    0x1.3p+6,
+    0x1.2cp+6,
+    0x1.28p+6,
+    0x1.24p+6,
+    0x1.2p+6,
+    0x1.1cp+6,
+    0x1.18p+6,
+    0x1.14p+6,
+    0x1.1p+6,
+    0x1.0cp+6,
+    0x1.08p+6,
+    0x1.04p+6,
+    0x1p+6,
+    0x1.f8p+5,
+    0x1.fp+5,
+    0x1.e8p+5,
+    0x1.ep+5,
+    0x1.d8p+5,
+    0x1.dp+5,
+    0x1.c8p+5,
+    0x1.cp+5,
+    0x1.b8p+5,
+    0x1.bp+5,
+    0x1.a8p+5,
+    0x1.ap+5,
+    0x1.98p+5,
+    0x1.9p+5,
+    0x1.88p+5,
+    0x1.8p+5,
+    0x1.78p+5,
+    0x1.7p+5,
+    0x1.68p+5,
+    0x1.6p+5,
+    0x1.58p+5,
+    0x1.5p+5,
+    0x1.48p+5,
+    0x1.4p+5,
+    0x1.38p+5,
+    0x1.3p+5,
+    0x1.28p+5,
+    0x1.2p+5,
+    0x1.18p+5,
+    0x1.1p+5,
+    0x1.08p+5,
+    0x1p+5,
+    0x1.fp+4,
+    0x1.ep+4,
+    0x1.dp+4,
+    0x1.cp+4,
+    0x1.bp+4,
+    0x1.ap+4,
+    0x1.9p+4,
+    0x1.8p+4,
+    0x1.7p+4,
+    0x1.6p+4,
+    0x1.5p+4,
+    0x1.4p+4,
+    0x1.3p+4,
+    0x1.2p+4,
+    0x1.1p+4,
+    0x1p+4,
+    0x1.ep+3,
+    0x1.cp+3,
+    0x1.ap+3,
+    0x1.8p+3,
+    0x1.6p+3,
+    0x1.4p+3,
+    0x1.2p+3,
+    0x1p+3,
+    0x1.cp+2,
+    0x1.8p+2,
+    0x1.4p+2,
+    0x1p+2,
+    0x1.8p+1,
+    0x1p+1,
+    0x1p+0,
+    0x0p+0,
+};
+
+inline constexpr double vote_slack = 0x1.01b2b29a4692cp-23;
+
+static_assert(sizeof(nodes) / sizeof(nodes[0]) == n_nodes, "node count mismatch");
+static_assert(sizeof(roots) / sizeof(roots[0]) == n_trees, "tree count mismatch");
+static_assert(sizeof(vote_rest_min) / sizeof(double) == n_trees + 1, "swing table mismatch");
+static_assert(sizeof(vote_rest_max) / sizeof(double) == n_trees + 1, "swing table mismatch");
+static_assert(ModelView(nodes, n_nodes, roots, n_trees, classes).is_valid(),
+    "node table has an out-of-range index");
+
+}
+
+// Predictor over the tables above; starting the process allocates and parses nothing
+inline constinit const ModelView embedded_model(
+    model_tables::nodes,
+    model_tables::n_nodes,
+    model_tables::roots,
+    model_tables::n_trees,
+    model_tables::classes,
+    VoteSwing{model_tables::vote_rest_min, model_tables::vote_rest_max, model_tables::vote_slack, nullptr}
+);
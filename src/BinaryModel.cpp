@@ -0,0 +1,160 @@
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "BinaryModel.h"
+#include "Predictor.h"
+
+using namespace std;
+
+namespace {
+
+uint64_t align_up(uint64_t offset, uint64_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+void write_at(ofstream& out, uint64_t offset, const void* data, size_t size) {
+    out.seekp(offset);
+    out.write(static_cast<const char*>(data), size);
+}
+
+}
+
+void write_binary_model(const Predictor& predictor, const string& path) {
+    const auto& forest = predictor.get_forest();
+    const auto& roots = forest.get_roots();
+
+    BinaryModelHeader header = {};
+    memcpy(header.magic, BINARY_MODEL_MAGIC, sizeof(header.magic));
+    header.version = BINARY_MODEL_VERSION;
+    header.byte_order = BINARY_MODEL_BYTE_ORDER;
+    header.n_features = N_FEATURES;
+    header.n_trees = roots.size();
+    header.n_nodes = forest.arena_size();
+    header.classes[0] = forest.get_classes()[0];
+    header.classes[1] = forest.get_classes()[1];
+
+    const auto& order = forest.get_eval_order();
+
+    header.roots_offset = sizeof(header);
+    header.order_offset = order.empty() ? 0 : header.roots_offset + roots.size() * sizeof(uint32_t);
+    header.nodes_offset = align_up(header.roots_offset + (roots.size() + order.size()) * sizeof(uint32_t), 64);
+
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out.is_open()) {
+        throw runtime_error("cannot write " + path);
+    }
+
+    write_at(out, 0, &header, sizeof(header));
+    write_at(out, header.roots_offset, roots.data(), roots.size() * sizeof(uint32_t));
+    if (!order.empty()) {
+        write_at(out, header.order_offset, order.data(), order.size() * sizeof(uint32_t));
+    }
+    write_at(out, header.nodes_offset, forest.get_arena(), forest.arena_size() * sizeof(ForestNode));
+
+    if (!out.good()) {
+        throw runtime_error("failed writing " + path);
+    }
+}
+
+MappedModel::MappedModel(MappedModel&& other) noexcept
+    : data(other.data), size(other.size),
+      rest_min(std::move(other.rest_min)), rest_max(std::move(other.rest_max)), model(other.model) {
+    other.data = nullptr;
+    other.size = 0;
+}
+
+MappedModel::~MappedModel() {
+    if (this->data != nullptr) {
+        munmap(this->data, this->size);
+    }
+}
+
+MappedModel MappedModel::open(const string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("cannot open " + path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BinaryModelHeader)) {
+        close(fd);
+        throw runtime_error(path + " is not a binary model");
+    }
+
+    const size_t size = st.st_size;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        throw runtime_error("cannot mmap " + path);
+    }
+
+    const auto* base = static_cast<const char*>(data);
+    const auto* header = reinterpret_cast<const BinaryModelHeader*>(base);
+
+    auto fail = [&](const string& reason) {
+        munmap(data, size);
+        throw runtime_error(path + ": " + reason);
+    };
+
+    if (memcmp(header->magic, BINARY_MODEL_MAGIC, sizeof(header->magic)) != 0) {
+        fail("bad magic");
+    }
+    if (header->version != BINARY_MODEL_VERSION) {
+        fail("unsupported version " + to_string(header->version));
+    }
+    if (header->byte_order != BINARY_MODEL_BYTE_ORDER) {
+        fail("written with a different byte order");
+    }
+    if (header->n_features != N_FEATURES) {
+        fail("expected " + to_string(N_FEATURES) + " features");
+    }
+
+    auto fits = [&](uint64_t offset, uint64_t bytes, uint64_t alignment) {
+        return offset % alignment == 0 && offset <= size && bytes <= size - offset;
+    };
+
+    if (!fits(header->roots_offset, uint64_t(header->n_trees) * sizeof(uint32_t), alignof(uint32_t))
+        || !fits(header->nodes_offset, uint64_t(header->n_nodes) * sizeof(ForestNode), alignof(ForestNode))) {
+        fail("section out of bounds");
+    }
+
+    const uint32_t* order = nullptr;
+    if (header->order_offset != 0) {
+        if (!fits(header->order_offset, uint64_t(header->n_trees) * sizeof(uint32_t), alignof(uint32_t))) {
+            fail("section out of bounds");
+        }
+
+        order = reinterpret_cast<const uint32_t*>(base + header->order_offset);
+
+        vector<bool> seen(header->n_trees, false);
+        for (uint32_t k = 0; k < header->n_trees; k++) {
+            if (order[k] >= header->n_trees || seen[order[k]]) {
+                fail("tree order is not a permutation");
+            }
+            seen[order[k]] = true;
+        }
+    }
+
+    const auto* nodes = reinterpret_cast<const ForestNode*>(base + header->nodes_offset);
+    const auto* roots = reinterpret_cast<const uint32_t*>(base + header->roots_offset);
+
+    if (!ModelView(nodes, header->n_nodes, roots, header->n_trees, header->classes).is_valid()) {
+        fail("node table has an out-of-range index");
+    }
+
+    MappedModel mapped(data, size);
+    const auto slack = compute_vote_swing(nodes, roots, header->n_trees, mapped.rest_min, mapped.rest_max, order);
+    mapped.model = ModelView(
+        nodes, header->n_nodes, roots, header->n_trees, header->classes,
+        VoteSwing{mapped.rest_min.data(), mapped.rest_max.data(), slack, order}
+    );
+
+    return mapped;
+}
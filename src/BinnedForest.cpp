@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "BinnedForest.h"
+#include "Forest.h"
+#include "Tree.h"
+
+using namespace std;
+
+// Rows binned and scored per block, so the ranks stay in L1
+constexpr size_t BIN_BLOCK = 64;
+
+BinnedRow BinnedForest::bin(const FeatureArray& features) const {
+    BinnedRow row;
+
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        const double* first = this->bounds.data() + this->offsets[f];
+        size_t n = this->offsets[f + 1] - this->offsets[f];
+
+        if (n == 0) {
+            row[f] = 0;
+            continue;
+        }
+
+        // Branchless lower bound on "goes right", which NaN always does
+        const double x = features[f];
+        const double* base = first;
+        while (n > 1) {
+            const auto half = n / 2;
+            base = !(x <= base[half]) ? base + half : base;
+            n -= half;
+        }
+
+        row[f] = static_cast<uint16_t>(base - first + !(x <= *base));
+    }
+
+    return row;
+}
+
+int BinnedForest::predict_binned(const BinnedRow& row) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (auto root: this->roots) {
+        const BinnedNode* node = this->nodes.data() + root;
+
+        while (node->feature != BINNED_LEAF) {
+            if (row[node->feature] <= node->rank) {
+                node += 1;
+            } else {
+                node += node->payload;
+            }
+        }
+
+        const auto& vote = this->leaf_votes[node->payload];
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+void BinnedForest::predict_binned(span<const BinnedRow> rows, span<int> out) const {
+    if (rows.size() != out.size()) {
+        throw invalid_argument("predict_binned needs one output slot per row");
+    }
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        out[i] = this->predict_binned(rows[i]);
+    }
+}
+
+int BinnedForest::predict(const FeatureArray& features) const {
+    return this->predict_binned(this->bin(features));
+}
+
+void BinnedForest::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    array<BinnedRow, BIN_BLOCK> block;
+
+    for (size_t first = 0; first < features.size(); first += BIN_BLOCK) {
+        const auto count = min(BIN_BLOCK, features.size() - first);
+
+        for (size_t i = 0; i < count; i++) {
+            block[i] = this->bin(features[first + i]);
+        }
+        for (size_t i = 0; i < count; i++) {
+            out[first + i] = this->predict_binned(block[i]);
+        }
+    }
+}
+
+BinnedForest BinnedForest::from_forest(const Forest& forest) {
+    BinnedForest bf;
+    vector<vector<double>> distinct(N_FEATURES);
+
+    for (const auto& tree: forest.get_trees()) {
+        for (const auto& node: tree.get_nodes()) {
+            if (node.feature != COMPACT_LEAF) {
+                distinct[node.feature].push_back(node.bound);
+            }
+        }
+    }
+
+    bf.offsets[0] = 0;
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        auto& list = distinct[f];
+
+        sort(list.begin(), list.end());
+        list.erase(unique(list.begin(), list.end()), list.end());
+
+        // A NaN rank is the bound count, which must still fit
+        if (list.size() > UINT16_MAX) {
+            throw invalid_argument("BinnedForest supports at most 65535 distinct bounds per feature");
+        }
+
+        bf.bounds.insert(bf.bounds.end(), list.begin(), list.end());
+        bf.offsets[f + 1] = bf.bounds.size();
+    }
+
+    for (const auto& tree: forest.get_trees()) {
+        const auto leaf_base = static_cast<uint32_t>(bf.leaf_votes.size());
+
+        bf.roots.push_back(bf.nodes.size());
+
+        for (const auto& node: tree.get_nodes()) {
+            if (node.feature == COMPACT_LEAF) {
+                bf.nodes.push_back(BinnedNode{0, BINNED_LEAF, node.payload + leaf_base});
+                continue;
+            }
+
+            const auto& list = distinct[node.feature];
+            const auto rank = lower_bound(list.begin(), list.end(), node.bound) - list.begin();
+            bf.nodes.push_back(BinnedNode{static_cast<uint16_t>(rank), node.feature, node.payload});
+        }
+
+        bf.leaf_votes.insert(bf.leaf_votes.end(), tree.get_leaf_votes().begin(), tree.get_leaf_votes().end());
+    }
+
+    bf.classes = forest.get_classes();
+
+    return bf;
+}
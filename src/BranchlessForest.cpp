@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "BranchlessForest.h"
+#include "Forest.h"
+#include "Tree.h"
+
+using namespace std;
+
+int BranchlessForest::predict(const FeatureArray& features) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (size_t t = 0; t < this->depths.size(); t++) {
+        const double* bounds = this->bounds.data() + this->node_offsets[t];
+        const uint8_t* feature = this->features.data() + this->node_offsets[t];
+        const uint32_t depth = this->depths[t];
+
+        uint32_t node = 0;
+        for (uint32_t level = 0; level < depth; level++) {
+            node = 2 * node + 1 + !(features[feature[node]] <= bounds[node]);
+        }
+
+        const auto leaf = this->slot_leaves[this->slot_offsets[t] + node - ((1u << depth) - 1)];
+        const auto& vote = this->leaf_votes[leaf];
+
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+namespace {
+
+int tree_depth(const Tree& tree, int node) {
+    if (tree.get_children_left()[node] == -1) {
+        return 0;
+    }
+
+    return 1 + max(
+        tree_depth(tree, tree.get_children_left()[node]),
+        tree_depth(tree, tree.get_children_right()[node])
+    );
+}
+
+}
+
+BranchlessForest BranchlessForest::from_forest(const Forest& forest) {
+    BranchlessForest bf;
+
+    for (const auto& tree: forest.get_trees()) {
+        const uint32_t depth = tree_depth(tree, 0);
+        if (depth > MAX_DEPTH) {
+            throw invalid_argument("BranchlessForest supports trees at most MAX_DEPTH levels deep");
+        }
+
+        const uint32_t internal = (1u << depth) - 1;
+        const uint32_t node_offset = bf.bounds.size();
+        const uint32_t slot_offset = bf.slot_leaves.size();
+
+        bf.depths.push_back(depth);
+        bf.node_offsets.push_back(node_offset);
+        bf.slot_offsets.push_back(slot_offset);
+
+        // Padding nodes never decide anything: every slot below them maps to
+        // the same leaf
+        bf.bounds.resize(node_offset + internal, INFINITY);
+        bf.features.resize(node_offset + internal, 0);
+        bf.slot_leaves.resize(slot_offset + internal + 1);
+
+        // (tree node, complete-tree position, level)
+        vector<tuple<int, uint32_t, uint32_t>> stack = {{0, 0, 0}};
+
+        while (!stack.empty()) {
+            const auto [node, position, level] = stack.back();
+            stack.pop_back();
+
+            if (tree.get_children_left()[node] == -1) {
+                const auto& value = tree.get_value()[node];
+                const uint32_t leaf = bf.leaf_votes.size();
+                bf.leaf_votes.push_back({get<0>(value), get<1>(value)});
+
+                // Leftmost bottom-level descendant, then all of its siblings
+                auto first = position;
+                for (auto l = level; l < depth; l++) {
+                    first = 2 * first + 1;
+                }
+                const auto count = 1u << (depth - level);
+
+                fill_n(bf.slot_leaves.begin() + slot_offset + (first - internal), count, leaf);
+                continue;
+            }
+
+            bf.bounds[node_offset + position] = tree.bound(node);
+            bf.features[node_offset + position] = tree.get_feature()[node];
+
+            stack.emplace_back(tree.get_children_right()[node], 2 * position + 2, level + 1);
+            stack.emplace_back(tree.get_children_left()[node], 2 * position + 1, level + 1);
+        }
+    }
+
+    bf.classes = forest.get_classes();
+
+    return bf;
+}
@@ -0,0 +1,47 @@
+#include "CompactForest.h"
+#include "Forest.h"
+#include "Tree.h"
+
+using namespace std;
+
+int CompactForest::predict(const FeatureArray& features) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (auto root: this->roots) {
+        const auto& vote = this->leaf_votes[compact_leaf(this->nodes.data() + root, features)];
+
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+CompactForest CompactForest::from_forest(const Forest& forest) {
+    CompactForest cf;
+
+    for (const auto& tree: forest.get_trees()) {
+        const auto leaf_base = static_cast<uint32_t>(cf.leaf_votes.size());
+
+        cf.roots.push_back(cf.nodes.size());
+
+        // Right offsets are relative and stay valid; leaf indices are per tree
+        for (auto node: tree.get_nodes()) {
+            if (node.feature == COMPACT_LEAF) {
+                node.payload += leaf_base;
+            }
+            cf.nodes.push_back(node);
+        }
+
+        cf.leaf_votes.insert(cf.leaf_votes.end(), tree.get_leaf_votes().begin(), tree.get_leaf_votes().end());
+    }
+
+    cf.classes = forest.get_classes();
+
+    return cf;
+}
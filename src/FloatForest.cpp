@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <immintrin.h>
+
+#include "FloatForest.h"
+#include "Forest.h"
+#include "Tree.h"
+
+using namespace std;
+
+namespace {
+
+// Vote index of the leaf reached from the tree starting at `root`
+uint32_t float_leaf(const FloatNode* root, const FeatureArrayF& features) {
+    const FloatNode* node = root;
+
+    while ((node->word & 0xFF) != COMPACT_LEAF) {
+        if (features[node->word & 0xFF] <= node->bound) {
+            node += 1;
+        } else {
+            node += node->word >> 8;
+        }
+    }
+
+    return node->word >> 8;
+}
+
+}
+
+int FloatForest::predict(const FeatureArrayF& features) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (auto root: this->roots) {
+        const auto& vote = this->leaf_votes[float_leaf(this->nodes.data() + root, features)];
+
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+void FloatForest::predict_batch(span<const FeatureArrayF> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        this->predict_avx2(features, out);
+    } else {
+        for (size_t i = 0; i < features.size(); i++) {
+            out[i] = this->predict(features[i]);
+        }
+    }
+}
+
+void FloatForest::predict_batch_avx2(span<const FeatureArrayF> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+    if (!__builtin_cpu_supports("avx2")) {
+        throw runtime_error("CPU does not support AVX2");
+    }
+
+    this->predict_avx2(features, out);
+}
+
+// Lane positions are node indices; with a scale of 8 bytes the bound sits
+// at +0 and the word at +4 of a FloatNode. The comparison is ordered, so
+// NaN lanes go right as in float_leaf. Leaf lanes are masked out of the
+// loads and stay put until every lane has reached a leaf.
+__attribute__((target("avx2")))
+void FloatForest::predict_avx2(span<const FeatureArrayF> features, span<int> out) const {
+    static_assert(sizeof(FloatNode) == 8, "node positions are scaled by 8 bytes");
+
+    constexpr size_t lanes = 8;
+    const auto* bounds = reinterpret_cast<const float*>(this->nodes.data());
+    const auto* words = reinterpret_cast<const int*>(this->nodes.data()) + 1;
+
+    const __m256i feature_bits = _mm256_set1_epi32(0xFF);
+    const __m256i leaf = _mm256_set1_epi32(COMPACT_LEAF);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    const __m256i row_offsets = _mm256_setr_epi32(
+        0, N_FEATURES, 2 * N_FEATURES, 3 * N_FEATURES, 4 * N_FEATURES, 5 * N_FEATURES, 6 * N_FEATURES, 7 * N_FEATURES
+    );
+
+    for (size_t first = 0; first < features.size(); first += lanes) {
+        const auto count = min(lanes, features.size() - first);
+
+        // A short block repeats its last row in the spare lanes
+        FeatureArrayF block[lanes];
+        for (size_t lane = 0; lane < lanes; lane++) {
+            block[lane] = features[first + min(lane, count - 1)];
+        }
+        const float* values = block[0].data();
+
+        double no_votes[lanes] = {};
+        double yes_votes[lanes] = {};
+
+        for (auto root: this->roots) {
+            __m256i at = _mm256_set1_epi32(static_cast<int>(root));
+            __m256i word;
+
+            while (true) {
+                word = _mm256_i32gather_epi32(words, at, 8);
+                const __m256i feature = _mm256_and_si256(word, feature_bits);
+                const __m256i internal = _mm256_xor_si256(_mm256_cmpeq_epi32(feature, leaf), all_ones);
+
+                if (_mm256_testz_si256(internal, internal)) {
+                    break;
+                }
+
+                const __m256 active = _mm256_castsi256_ps(internal);
+                const __m256 bound = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), bounds, at, active, 8);
+                const __m256 x = _mm256_mask_i32gather_ps(
+                    _mm256_setzero_ps(), values, _mm256_add_epi32(row_offsets, feature), active, 4
+                );
+
+                const __m256i left = _mm256_castps_si256(_mm256_cmp_ps(x, bound, _CMP_LE_OQ));
+                const __m256i step = _mm256_blendv_epi8(_mm256_srli_epi32(word, 8), _mm256_set1_epi32(1), left);
+                at = _mm256_add_epi32(at, _mm256_and_si256(step, internal));
+            }
+
+            alignas(32) uint32_t leaves[lanes];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(leaves), _mm256_srli_epi32(word, 8));
+
+            for (size_t lane = 0; lane < count; lane++) {
+                no_votes[lane] += this->leaf_votes[leaves[lane]][0];
+                yes_votes[lane] += this->leaf_votes[leaves[lane]][1];
+            }
+        }
+
+        for (size_t lane = 0; lane < count; lane++) {
+            out[first + lane] = yes_votes[lane] >= no_votes[lane] ? this->classes[1] : this->classes[0];
+        }
+    }
+}
+
+float FloatForest::float_bound(double bound) {
+    auto f = static_cast<float>(bound);
+
+    if (static_cast<double>(f) > bound) {
+        f = nextafterf(f, -INFINITY);
+    }
+
+    return f;
+}
+
+FloatForest FloatForest::from_forest(const Forest& forest) {
+    FloatForest ff;
+
+    const auto& trees = forest.get_trees();
+    for (uint32_t t = 0; t < trees.size(); t++) {
+        const auto leaf_base = static_cast<uint32_t>(ff.leaf_votes.size());
+        const auto& nodes = trees[t].get_nodes();
+
+        ff.roots.push_back(ff.nodes.size());
+
+        for (uint32_t i = 0; i < nodes.size(); i++) {
+            const auto& node = nodes[i];
+            auto payload = node.payload;
+
+            if (node.feature == COMPACT_LEAF) {
+                payload += leaf_base;
+            }
+            if (payload >= (1u << 24)) {
+                throw invalid_argument("FloatForest supports at most 2^24 nodes per tree and leaves in all");
+            }
+
+            auto bound = 0.0f;
+            if (node.feature != COMPACT_LEAF) {
+                bound = float_bound(node.bound);
+
+                // Doubles above the bound must not round to a float at or below it
+                const bool exact = node.bound == INFINITY || (
+                    static_cast<float>(node.bound) == bound
+                    && static_cast<float>(nextafter(node.bound, INFINITY)) > bound
+                );
+
+                ff.rounding.nodes++;
+                if (exact) {
+                    ff.rounding.exact++;
+                } else {
+                    ff.rounding.inexact.emplace_back(t, i);
+                }
+            }
+
+            ff.nodes.push_back(FloatNode{bound, (payload << 8) | node.feature});
+        }
+
+        ff.leaf_votes.insert(ff.leaf_votes.end(), trees[t].get_leaf_votes().begin(), trees[t].get_leaf_votes().end());
+    }
+
+    ff.classes = forest.get_classes();
+
+    return ff;
+}
@@ -1,4 +1,20 @@
-﻿#include "Forest.h"
+﻿#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <chrono>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "BinnedForest.h"
+#include "BranchlessForest.h"
+#include "CompactForest.h"
+#include "Forest.h"
+#include "GatherForest.h"
+#include "GemmForest.h"
+#include "LookupForest.h"
+#include "QuickScorer.h"
 #include "Scaler.h"
 #include "Tree.h"
 
@@ -6,21 +22,762 @@ using json = nlohmann::json;
 using namespace std;
 
 int Forest::predict(const FeatureArray& features) const {
-    tuple<double, double> class_votes = make_tuple(0.0, 0.0);
+    if (this->engine_impl) {
+        return this->engine_impl->predict(features);
+    }
 
-    for (auto& tree: this->trees) {
-        auto vote = tree.predict(features);
+    if (this->cascade.prefix_trees > 0) {
+        return this->cascade_vote(features).label;
+    }
+
+    if (this->interleave > 0 && !this->early_exit) {
+        return predict_arena_interleaved(
+            this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features,
+            this->interleave
+        );
+    }
+
+    if (this->leaf_margins && !this->early_exit) {
+        return predict_arena_margin(
+            this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features,
+            this->vote_slack
+        );
+    }
+
+    return predict_arena(
+        this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features,
+        this->vote_swing(this->early_exit)
+    );
+}
+
+AnytimeVote Forest::predict_within(const FeatureArray& features, chrono::nanoseconds budget) const {
+    const auto deadline = chrono::steady_clock::now() + budget;
+    const auto swing = this->vote_swing(true);
+    const auto n_trees = this->roots.size();
+
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (size_t k = 0; k < n_trees; k++) {
+        const auto* leaf = arena_leaf(
+            this->arena.data(), this->roots[swing.order ? swing.order[k] : k], features
+        );
+
+        no_votes += leaf->votes[0];
+        yes_votes += leaf->votes[1];
+
+        if (auto outcome = vote_outcome(swing, k + 1, no_votes, yes_votes)) {
+            return {this->classes[outcome > 0 ? 1 : 0], k + 1, yes_votes - no_votes, true};
+        }
+
+        // The clock costs about as much as a walk, so it is read after the
+        // first tree and then once per DEADLINE_STRIDE trees
+        if (k % DEADLINE_STRIDE == 0 && k + 1 < n_trees && chrono::steady_clock::now() >= deadline) {
+            return {
+                this->classes[yes_votes >= no_votes ? 1 : 0], k + 1, yes_votes - no_votes, false
+            };
+        }
+    }
+
+    if (!swing.order) {
+        return {this->classes[yes_votes >= no_votes ? 1 : 0], n_trees, yes_votes - no_votes, true};
+    }
+
+    // Every tree walked out of order and still within the slack: the sum in
+    // tree order decides
+    auto full = arena_vote(this->arena.data(), this->roots.data(), n_trees, this->classes.data(), features);
+    return {full.label, n_trees, full.yes_votes - full.no_votes, true};
+}
+
+void Forest::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    if (this->engine_impl) {
+        this->engine_impl->predict_batch(features, out);
+        return;
+    }
+
+    if (this->cascade.prefix_trees > 0) {
+        for (size_t i = 0; i < features.size(); i++) {
+            out[i] = this->cascade_vote(features[i]).label;
+        }
+        return;
+    }
+
+    if (this->prefetch_group > 0 && !this->early_exit) {
+        predict_arena_amac(
+            this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features, out,
+            this->prefetch_group
+        );
+        return;
+    }
+
+    predict_arena_batch(
+        this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features, out,
+        this->tiling, this->vote_swing(this->early_exit), LeafMargins{this->leaf_margins, this->vote_slack}
+    );
+}
+
+VoteSwing Forest::vote_swing(bool enabled) const {
+    if (!enabled) {
+        return {};
+    }
+
+    return {
+        this->vote_rest_min.data(), this->vote_rest_max.data(), this->vote_slack,
+        this->eval_order.empty() ? nullptr : this->eval_order.data()
+    };
+}
+
+void Forest::build_vote_swing() {
+    this->vote_slack = compute_vote_swing(
+        this->arena.data(), this->roots.data(), this->roots.size(), this->vote_rest_min, this->vote_rest_max,
+        this->eval_order.empty() ? nullptr : this->eval_order.data()
+    );
+}
+
+// Stage one sums the prefix; stage two carries the same sums on with exact
+// early exit, so a row passed on gets the full forest's label
+ArenaVote Forest::cascade_vote(const FeatureArray& features) const {
+    const auto swing = this->vote_swing(true);
+    const auto n_trees = this->roots.size();
+
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (size_t k = 0; k < n_trees; k++) {
+        const auto* leaf = arena_leaf(
+            this->arena.data(), this->roots[swing.order ? swing.order[k] : k], features
+        );
+
+        no_votes += leaf->votes[0];
+        yes_votes += leaf->votes[1];
+
+        if (k + 1 == this->cascade.prefix_trees) {
+            const auto margin = yes_votes - no_votes;
+
+            if (margin > this->cascade.band_high) {
+                return {this->classes[1], k + 1, no_votes, yes_votes};
+            } else if (margin < this->cascade.band_low) {
+                return {this->classes[0], k + 1, no_votes, yes_votes};
+            }
+        } else if (k + 1 > this->cascade.prefix_trees) {
+            if (auto outcome = vote_outcome(swing, k + 1, no_votes, yes_votes)) {
+                return {this->classes[outcome > 0 ? 1 : 0], k + 1, no_votes, yes_votes};
+            }
+        }
+    }
+
+    if (!swing.order) {
+        return {this->classes[yes_votes >= no_votes ? 1 : 0], n_trees, no_votes, yes_votes};
+    }
+
+    auto full = arena_vote(this->arena.data(), this->roots.data(), n_trees, this->classes.data(), features);
+    full.trees += n_trees;
+    return full;
+}
+
+CascadeConfig Forest::calibrate_cascade(span<const FeatureArray> calibration, size_t prefix_trees) const {
+    if (prefix_trees == 0 || prefix_trees > this->roots.size()) {
+        throw invalid_argument("cascade prefix must be between 1 and the number of trees");
+    }
+
+    const auto swing = this->vote_swing(true);
+
+    // Widest partial margin among rows the full forest labels 0, and the
+    // narrowest among rows it labels 1
+    double highest_no = -INFINITY;
+    double lowest_yes = INFINITY;
+    double highest = -INFINITY;
+    double lowest = INFINITY;
+
+    for (const auto& features: calibration) {
+        double no_votes = 0.0;
+        double yes_votes = 0.0;
 
-        get<0>(class_votes) += get<0>(vote);
-        get<1>(class_votes) += get<1>(vote);
+        for (size_t k = 0; k < prefix_trees; k++) {
+            const auto* leaf = arena_leaf(
+                this->arena.data(), this->roots[swing.order ? swing.order[k] : k], features
+            );
+            no_votes += leaf->votes[0];
+            yes_votes += leaf->votes[1];
+        }
+
+        const auto margin = yes_votes - no_votes;
+        const auto label = predict_arena(
+            this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features
+        );
+
+        if (label == this->classes[1]) {
+            lowest_yes = min(lowest_yes, margin);
+        } else {
+            highest_no = max(highest_no, margin);
+        }
+        highest = max(highest, margin);
+        lowest = min(lowest, margin);
+    }
+
+    // With no row of one class, only margins beyond everything seen are taken
+    return {
+        prefix_trees,
+        lowest_yes != INFINITY ? lowest_yes : lowest,
+        highest_no != -INFINITY ? highest_no : highest
+    };
+}
+
+void Forest::set_cascade(CascadeConfig cascade) {
+    if (cascade.prefix_trees > this->roots.size()) {
+        throw invalid_argument("cascade prefix is longer than the forest");
+    }
+
+    this->cascade = cascade;
+}
+
+CascadeStats Forest::cascade_stats(span<const FeatureArray> rows) const {
+    CascadeStats stats;
+    size_t trees = 0;
+
+    for (const auto& features: rows) {
+        auto vote = this->cascade.prefix_trees > 0
+            ? this->cascade_vote(features)
+            : arena_vote(this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features);
+
+        stats.rows++;
+        stats.passed += vote.trees > this->cascade.prefix_trees && this->cascade.prefix_trees > 0;
+        trees += vote.trees;
     }
 
-    auto no_votes = get<0>(class_votes);
-    auto yes_votes = get<1>(class_votes);
+    stats.mean_trees = rows.empty() ? 0.0 : static_cast<double>(trees) / rows.size();
+
+    return stats;
+}
 
-    if (yes_votes >= no_votes) {
-        return this->classes[1];
+double Forest::mean_trees_evaluated(span<const FeatureArray> rows) const {
+    if (rows.empty()) {
+        return 0.0;
+    }
+
+    const auto swing = this->vote_swing(true);
+    size_t trees = 0;
+
+    for (const auto& features: rows) {
+        trees += arena_vote(
+            this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features, swing
+        ).trees;
+    }
+
+    return static_cast<double>(trees) / rows.size();
+}
+
+ReorderReport Forest::reorder_trees(span<const FeatureArray> calibration) {
+    this->eval_order.clear();
+    this->build_vote_swing();
+
+    ReorderReport report;
+    report.mean_trees_before = this->mean_trees_evaluated(calibration);
+
+    // Spread of yes - no over each tree's leaves
+    vector<double> spread(this->trees.size());
+    for (size_t t = 0; t < this->trees.size(); t++) {
+        spread[t] = this->vote_rest_max[t] - this->vote_rest_max[t + 1]
+            - (this->vote_rest_min[t] - this->vote_rest_min[t + 1]);
+    }
+
+    // Share of calibration rows on which each tree's own vote agrees with the forest
+    vector<size_t> agree(this->trees.size(), 0);
+    for (const auto& features: calibration) {
+        const bool yes = this->predict(features) == this->classes[1];
+
+        for (size_t t = 0; t < this->trees.size(); t++) {
+            const auto* leaf = arena_leaf(this->arena.data(), this->roots[t], features);
+            agree[t] += (leaf->votes[1] >= leaf->votes[0]) == yes;
+        }
+    }
+
+    vector<double> score(this->trees.size());
+    for (size_t t = 0; t < this->trees.size(); t++) {
+        score[t] = spread[t] * (calibration.empty() ? 1.0 : static_cast<double>(agree[t]) / calibration.size());
+    }
+
+    vector<uint32_t> order(this->trees.size());
+    for (size_t t = 0; t < order.size(); t++) {
+        order[t] = t;
+    }
+    stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return score[a] > score[b];
+    });
+
+    this->eval_order = order;
+    this->build_vote_swing();
+    report.mean_trees_after = this->mean_trees_evaluated(calibration);
+
+    if (report.mean_trees_after >= report.mean_trees_before) {
+        this->eval_order.clear();
+        this->build_vote_swing();
+        report.mean_trees_after = report.mean_trees_before;
+    }
+
+    this->expected_trees = report.mean_trees_after;
+
+    return report;
+}
+
+void Forest::build_arena() {
+    if (this->shared_arena) {
+        this->build_shared_arena();
     } else {
-        return this->classes[0];
+        this->build_tree_arena();
+    }
+
+    this->hot_levels = 0;
+    this->hot_bytes = 0;
+    if (this->hot_budget > 0) {
+        this->pack_hot_levels();
     }
+
+    this->build_vote_swing();
+}
+
+// Lays the trees out breadth-first in one arena. Each tree starts on an even
+// slot followed by one padding slot, so every sibling pair lands in a single
+// 64-byte line and the right child is always `left + 1`.
+void Forest::build_tree_arena() {
+    this->arena.clear();
+    this->roots.clear();
+
+    for (const auto& tree: this->trees) {
+        const auto& feature = tree.get_feature();
+        const auto& children_left = tree.get_children_left();
+        const auto& children_right = tree.get_children_right();
+        const auto& value = tree.get_value();
+
+        const auto root = static_cast<uint32_t>(this->arena.size());
+        this->roots.push_back(root);
+        this->arena.resize(root + 2, ForestNode{0.0, -1, 0, {0.0, 0.0}});
+
+        // (tree node, arena slot) pairs still to be filled in
+        vector<pair<int, uint32_t>> queue = {{0, root}};
+
+        for (size_t i = 0; i < queue.size(); i++) {
+            const auto [node, slot] = queue[i];
+
+            if (children_left[node] == -1) {
+                this->arena[slot] = ForestNode{
+                    get<1>(value[node]) - get<0>(value[node]), -1, 0, {get<0>(value[node]), get<1>(value[node])}
+                };
+                continue;
+            }
+
+            const auto left = static_cast<uint32_t>(this->arena.size());
+            this->arena.resize(left + 2);
+            this->arena[slot] = ForestNode{tree.bound(node), feature[node], left, {0.0, 0.0}};
+
+            queue.emplace_back(children_left[node], left);
+            queue.emplace_back(children_right[node], left + 1);
+        }
+    }
+}
+
+// Moves every two-slot unit whose depth is below hot_levels on all paths
+// from a root to the front of the arena, keeping the relative order on both
+// sides; hot_levels is the most whole levels that fit in hot_budget. A
+// unit's parents are then all hot as well, so children still follow their
+// parents, and the top levels of every tree share one block.
+void Forest::pack_hot_levels() {
+    const auto units = this->arena.size() / 2;
+    const auto unit_bytes = 2 * sizeof(ForestNode);
+    if (units == 0) {
+        return;
+    }
+
+    // The arena is topological, so one forward pass settles the deepest path
+    vector<size_t> depth(units, 0);
+    for (size_t slot = 0; slot < this->arena.size(); slot++) {
+        const auto& node = this->arena[slot];
+
+        if (node.feature != -1) {
+            depth[node.left / 2] = max(depth[node.left / 2], depth[slot / 2] + 1);
+        }
+    }
+
+    // Units of depth below k, for k = 1, 2, ...
+    vector<size_t> below(*max_element(depth.begin(), depth.end()) + 2, 0);
+    for (auto d: depth) {
+        below[d + 1]++;
+    }
+    for (size_t k = 1; k < below.size(); k++) {
+        below[k] += below[k - 1];
+    }
+
+    while (this->hot_levels + 1 < below.size() && below[this->hot_levels + 1] * unit_bytes <= this->hot_budget) {
+        this->hot_levels++;
+    }
+    if (this->hot_levels == 0) {
+        return;
+    }
+
+    vector<uint32_t> order;
+    for (bool hot: {true, false}) {
+        for (uint32_t u = 0; u < units; u++) {
+            if ((depth[u] < this->hot_levels) == hot) {
+                order.push_back(u);
+            }
+        }
+    }
+    this->hot_bytes = below[this->hot_levels] * unit_bytes;
+
+    vector<uint32_t> moved_to(units);
+    for (uint32_t u = 0; u < units; u++) {
+        moved_to[order[u]] = u;
+    }
+
+    decltype(this->arena) packed(this->arena.size());
+    for (uint32_t u = 0; u < units; u++) {
+        for (uint32_t half = 0; half < 2; half++) {
+            auto node = this->arena[2 * order[u] + half];
+            if (node.feature != -1) {
+                node.left = 2 * moved_to[node.left / 2];
+            }
+
+            packed[2 * u + half] = node;
+        }
+    }
+
+    this->arena = std::move(packed);
+    for (auto& root: this->roots) {
+        root = 2 * moved_to[root / 2];
+    }
+}
+
+// Hash-conses the trees into one pool: equal subtrees anywhere in the forest
+// get one id, and each distinct sibling pair (or root) is stored once, so
+// the arena becomes a DAG that arena_leaf walks unchanged. Pairs are laid
+// out by decreasing height, which keeps every child after its parent as
+// ModelView::is_valid requires. Keys compare bit patterns, so shared nodes
+// are exactly equal.
+void Forest::build_shared_arena() {
+    struct Shared {
+        ForestNode node;
+        int left;
+        int right;
+        int height;
+    };
+
+    vector<Shared> pool;
+    map<tuple<int32_t, uint64_t, uint64_t, uint64_t>, int> interned;
+    vector<int> tree_roots;
+
+    for (const auto& tree: this->trees) {
+        const auto& feature = tree.get_feature();
+        const auto& children_left = tree.get_children_left();
+        const auto& children_right = tree.get_children_right();
+        const auto& value = tree.get_value();
+
+        // preorder, so that walking it backwards meets children first
+        vector<int> order;
+        vector<int> stack = {0};
+        while (!stack.empty()) {
+            const auto node = stack.back();
+            stack.pop_back();
+            order.push_back(node);
+
+            if (children_left[node] != -1) {
+                stack.push_back(children_right[node]);
+                stack.push_back(children_left[node]);
+            }
+        }
+
+        vector<int> id(tree.node_count(), -1);
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const auto node = *it;
+            Shared shared;
+            tuple<int32_t, uint64_t, uint64_t, uint64_t> key;
+
+            if (children_left[node] == -1) {
+                const auto no = get<0>(value[node]);
+                const auto yes = get<1>(value[node]);
+
+                shared = {ForestNode{yes - no, -1, 0, {no, yes}}, -1, -1, 0};
+                key = {-1, bit_cast<uint64_t>(no), bit_cast<uint64_t>(yes), 0};
+            } else {
+                const auto left = id[children_left[node]];
+                const auto right = id[children_right[node]];
+
+                shared = {
+                    ForestNode{tree.bound(node), feature[node], 0, {0.0, 0.0}}, left, right,
+                    1 + max(pool[left].height, pool[right].height)
+                };
+                key = {
+                    feature[node], bit_cast<uint64_t>(tree.bound(node)),
+                    static_cast<uint64_t>(left), static_cast<uint64_t>(right)
+                };
+            }
+
+            auto [entry, added] = interned.try_emplace(key, static_cast<int>(pool.size()));
+            if (added) {
+                pool.push_back(shared);
+            }
+            id[node] = entry->second;
+        }
+
+        tree_roots.push_back(id[0]);
+    }
+
+    // Two-slot units: a sibling pair, or a root (second == -1) plus padding
+    vector<pair<int, int>> units;
+    map<pair<int, int>, size_t> unit_index;
+
+    auto add_unit = [&](int first, int second) {
+        if (!unit_index.try_emplace({first, second}, units.size()).second) {
+            return false;
+        }
+
+        units.emplace_back(first, second);
+        return true;
+    };
+
+    for (auto root: tree_roots) {
+        if (!add_unit(root, -1)) {
+            continue;
+        }
+
+        vector<int> queue = {root};
+        for (size_t i = 0; i < queue.size(); i++) {
+            const auto& shared = pool[queue[i]];
+
+            if (shared.left != -1 && add_unit(shared.left, shared.right)) {
+                queue.push_back(shared.left);
+                queue.push_back(shared.right);
+            }
+        }
+    }
+
+    auto height = [&](const pair<int, int>& unit) {
+        return max(pool[unit.first].height, unit.second == -1 ? 0 : pool[unit.second].height);
+    };
+
+    stable_sort(units.begin(), units.end(), [&](const pair<int, int>& a, const pair<int, int>& b) {
+        return height(a) > height(b);
+    });
+
+    for (size_t u = 0; u < units.size(); u++) {
+        unit_index[units[u]] = u;
+    }
+
+    this->arena.assign(2 * units.size(), ForestNode{0.0, -1, 0, {0.0, 0.0}});
+    for (size_t u = 0; u < units.size(); u++) {
+        const auto [first, second] = units[u];
+
+        for (auto [slot, member]: {pair{2 * u, first}, pair{2 * u + 1, second}}) {
+            if (member == -1) {
+                continue;
+            }
+
+            this->arena[slot] = pool[member].node;
+            if (pool[member].left != -1) {
+                this->arena[slot].left = 2 * unit_index.at({pool[member].left, pool[member].right});
+            }
+        }
+    }
+
+    this->roots.clear();
+    for (auto root: tree_roots) {
+        this->roots.push_back(2 * unit_index.at({root, -1}));
+    }
+}
+
+void Forest::fold_scaler(const Scaler& scaler) {
+    for (auto& tree: this->trees) {
+        tree.fold_scaler(scaler);
+    }
+
+    this->build_arena();
+    this->set_engine(this->engine);
+}
+
+OptimiseReport Forest::optimise(OptimiseOptions options) {
+    OptimiseReport report;
+    report.arena_before = this->arena.size();
+
+    for (auto& tree: this->trees) {
+        report.nodes_before += tree.node_count();
+
+        if (options.fold_epsilon && !tree.is_folded()) {
+            report.thresholds_folded += tree.node_count() / 2;
+            tree.fold_epsilon();
+        }
+
+        if (options.prune_dead || options.collapse_identical) {
+            const auto stats = tree.simplify(options.prune_dead, options.collapse_identical);
+            report.dead_removed += stats.dead;
+            report.collapsed += stats.collapsed;
+        }
+
+        if (options.drop_node_samples) {
+            tree.drop_node_samples();
+        }
+
+        report.nodes_after += tree.node_count();
+    }
+
+    this->leaf_margins = options.leaf_margins;
+    this->shared_arena = options.share_subtrees;
+
+    this->build_arena();
+    this->set_engine(this->engine);
+    report.arena_after = this->arena.size();
+
+    return report;
+}
+
+void Forest::set_tiling(ArenaTiling tiling) {
+    if (tiling.trees == 0 || tiling.samples == 0) {
+        throw invalid_argument("tile sizes must be non-zero");
+    }
+
+    this->tiling = tiling;
+}
+
+void Forest::set_interleave(size_t group) {
+    if (group > MAX_INTERLEAVE) {
+        throw invalid_argument("at most MAX_INTERLEAVE trees can be interleaved");
+    }
+
+    this->interleave = group;
+}
+
+void Forest::set_hot_table_budget(size_t bytes) {
+    this->hot_budget = bytes;
+    this->build_arena();
+    this->set_engine(this->engine);
+}
+
+void Forest::set_lookup_levels(size_t levels) {
+    if (levels == 0 || levels > LookupForest::MAX_LEVELS) {
+        throw invalid_argument("lookup tables cover 1 to MAX_LEVELS levels");
+    }
+
+    this->lookup_levels = levels;
+    if (this->engine == Engine::Lookup) {
+        this->set_engine(this->engine);
+    }
+}
+
+void Forest::set_engine(Engine engine) {
+    this->engine = engine;
+
+    switch (engine) {
+    case Engine::Arena:
+        this->engine_impl.reset();
+        break;
+    case Engine::QuickScorer:
+        this->engine_impl = make_shared<QuickScorer>(QuickScorer::from_forest(*this));
+        break;
+    case Engine::Branchless:
+        this->engine_impl = make_shared<BranchlessForest>(BranchlessForest::from_forest(*this));
+        break;
+    case Engine::Compact:
+        this->engine_impl = make_shared<CompactForest>(CompactForest::from_forest(*this));
+        break;
+    case Engine::Binned:
+        this->engine_impl = make_shared<BinnedForest>(BinnedForest::from_forest(*this));
+        break;
+    case Engine::Gather:
+        this->engine_impl = make_shared<GatherForest>(GatherForest::from_forest(*this));
+        break;
+    case Engine::Gemm:
+        this->engine_impl = make_shared<GemmForest>(GemmForest::from_forest(*this));
+        break;
+    case Engine::Lookup:
+        this->engine_impl = make_shared<LookupForest>(LookupForest::from_forest(*this, this->lookup_levels));
+        break;
+    }
+}
+
+Forest::Engine Forest::engine_from_name(const string& name) {
+    if (name == "arena") {
+        return Engine::Arena;
+    } else if (name == "quickscorer") {
+        return Engine::QuickScorer;
+    } else if (name == "branchless") {
+        return Engine::Branchless;
+    } else if (name == "compact") {
+        return Engine::Compact;
+    } else if (name == "binned") {
+        return Engine::Binned;
+    } else if (name == "gather") {
+        return Engine::Gather;
+    } else if (name == "gemm") {
+        return Engine::Gemm;
+    } else if (name == "lookup") {
+        return Engine::Lookup;
+    }
+
+    throw invalid_argument("unknown forest engine: " + name);
+}
+
+void to_json(json& j, const Forest& f) {
+    j = json{
+        {"n_estimators", f.n_estimators},
+        {"n_features", f.n_features},
+        {"n_classes", f.n_classes},
+        {"classes", f.classes},
+        {"trees", f.trees}
+    };
+
+    if (!f.eval_order.empty()) {
+        j["eval_order"] = f.eval_order;
+        j["expected_trees_evaluated"] = f.expected_trees;
+    }
+
+    if (f.cascade.prefix_trees > 0) {
+        j["cascade"] = {
+            {"prefix_trees", f.cascade.prefix_trees},
+            {"band_low", f.cascade.band_low},
+            {"band_high", f.cascade.band_high}
+        };
+    }
+}
+
+void from_json(const json& j, Forest& f) {
+    j.at("n_estimators").get_to(f.n_estimators);
+    j.at("n_features").get_to(f.n_features);
+    j.at("n_classes").get_to(f.n_classes);
+    j.at("classes").get_to(f.classes);
+    j.at("trees").get_to(f.trees);
+
+    f.eval_order.clear();
+    if (j.contains("eval_order")) {
+        j.at("eval_order").get_to(f.eval_order);
+
+        // must be a permutation of the trees
+        vector<bool> seen(f.trees.size(), false);
+        for (auto t: f.eval_order) {
+            if (t >= f.trees.size() || seen[t]) {
+                throw invalid_argument("eval_order is not a permutation of the trees");
+            }
+            seen[t] = true;
+        }
+        if (f.eval_order.size() != f.trees.size()) {
+            throw invalid_argument("eval_order is not a permutation of the trees");
+        }
+    }
+    if (j.contains("expected_trees_evaluated")) {
+        j.at("expected_trees_evaluated").get_to(f.expected_trees);
+    }
+
+    f.cascade = {};
+    if (j.contains("cascade")) {
+        const auto& c = j.at("cascade");
+        f.cascade = {c.at("prefix_trees").get<size_t>(), c.at("band_low").get<double>(), c.at("band_high").get<double>()};
+
+        if (f.cascade.prefix_trees > f.trees.size()) {
+            throw invalid_argument("cascade prefix is longer than the forest");
+        }
+    }
+
+    f.build_arena();
+    f.set_engine(f.engine);
 }
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <stdexcept>
+#include <immintrin.h>
+
+#include "Forest.h"
+#include "GatherForest.h"
+
+using namespace std;
+
+int GatherForest::predict(const FeatureArray& features) const {
+    return predict_arena(this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), features);
+}
+
+void GatherForest::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        this->predict_avx2(features, out);
+    } else {
+        for (size_t i = 0; i < features.size(); i++) {
+            out[i] = this->predict(features[i]);
+        }
+    }
+}
+
+// Node positions are kept in doubles (node index * 4), so the bound is at
+// +0, the (feature, left) word at +1 and the votes at +2 and +3 of a
+// ForestNode. A leaf's feature is -1, all ones in the low half of its word.
+__attribute__((target("avx2")))
+void GatherForest::predict_avx2(span<const FeatureArray> features, span<int> out) const {
+    static_assert(sizeof(ForestNode) == 4 * sizeof(double), "node positions are counted in doubles");
+
+    constexpr size_t lanes = 4;
+    const auto* nodes = reinterpret_cast<const double*>(this->arena.data());
+    const auto* words = reinterpret_cast<const long long*>(this->arena.data());
+
+    const __m256i low_half = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i row_offsets = _mm256_setr_epi64x(0, N_FEATURES, 2 * N_FEATURES, 3 * N_FEATURES);
+
+    for (size_t first = 0; first < features.size(); first += lanes) {
+        const auto count = min(lanes, features.size() - first);
+
+        // A short block repeats its last row in the spare lanes
+        FeatureArray block[lanes];
+        for (size_t lane = 0; lane < lanes; lane++) {
+            block[lane] = features[first + min(lane, count - 1)];
+        }
+        const auto* values = block[0].data();
+
+        __m256d no_votes = _mm256_setzero_pd();
+        __m256d yes_votes = _mm256_setzero_pd();
+
+        for (auto root: this->roots) {
+            __m256i at = _mm256_set1_epi64x(static_cast<long long>(root) * 4);
+
+            while (true) {
+                const __m256i word = _mm256_i64gather_epi64(words, _mm256_add_epi64(at, _mm256_set1_epi64x(1)), 8);
+                const __m256i feature = _mm256_and_si256(word, low_half);
+                const __m256i internal = _mm256_xor_si256(_mm256_cmpeq_epi64(feature, low_half), _mm256_set1_epi64x(-1));
+                const __m256d active = _mm256_castsi256_pd(internal);
+
+                if (_mm256_movemask_pd(active) == 0) {
+                    break;
+                }
+
+                const __m256d x = _mm256_mask_i64gather_pd(
+                    _mm256_setzero_pd(), values, _mm256_add_epi64(row_offsets, feature), active, 8
+                );
+                const __m256d bound = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), nodes, at, active, 8);
+
+                // NaN compares not-less-equal and goes right, as in Tree::predict
+                const __m256i right = _mm256_castpd_si256(_mm256_cmp_pd(x, bound, _CMP_NLE_UQ));
+                const __m256i left = _mm256_srli_epi64(word, 32);
+                const __m256i next = _mm256_slli_epi64(_mm256_sub_epi64(left, right), 2);
+
+                at = _mm256_blendv_epi8(at, next, internal);
+            }
+
+            no_votes = _mm256_add_pd(no_votes, _mm256_i64gather_pd(nodes, _mm256_add_epi64(at, _mm256_set1_epi64x(2)), 8));
+            yes_votes = _mm256_add_pd(yes_votes, _mm256_i64gather_pd(nodes, _mm256_add_epi64(at, _mm256_set1_epi64x(3)), 8));
+        }
+
+        alignas(32) double no[lanes];
+        alignas(32) double yes[lanes];
+        _mm256_store_pd(no, no_votes);
+        _mm256_store_pd(yes, yes_votes);
+
+        for (size_t lane = 0; lane < count; lane++) {
+            out[first + lane] = yes[lane] >= no[lane] ? this->classes[1] : this->classes[0];
+        }
+    }
+}
+
+GatherForest GatherForest::from_forest(const Forest& forest) {
+    GatherForest gf;
+
+    gf.arena.assign(forest.get_arena(), forest.get_arena() + forest.arena_size());
+    gf.roots = forest.get_roots();
+    gf.classes = forest.get_classes();
+
+    return gf;
+}
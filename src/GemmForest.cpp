@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Forest.h"
+#include "GemmForest.h"
+#include "Tree.h"
+
+using namespace std;
+
+// Rows per block; one block's intermediates stay within L2
+constexpr size_t GEMM_BLOCK = 64;
+
+namespace {
+
+// c (m x n) = a (m x k) b (k x n), all row major. The inner loop runs along
+// a row of b and c, which the compiler vectorises.
+void gemm(size_t m, size_t n, size_t k, const double* a, const double* b, double* c) {
+    fill(c, c + m * n, 0.0);
+
+    for (size_t i = 0; i < m; i++) {
+        for (size_t p = 0; p < k; p++) {
+            const auto scale = a[i * k + p];
+            if (scale == 0.0) {
+                continue;
+            }
+
+            for (size_t j = 0; j < n; j++) {
+                c[i * n + j] += scale * b[p * n + j];
+            }
+        }
+    }
+}
+
+// Intermediates of one block, kept per thread and grown to the widest
+// forest seen, so scoring does not allocate after the first block
+struct GemmScratch {
+    vector<double> x;
+    vector<size_t> packed;
+    vector<double> s;
+    vector<double> p;
+    vector<double> leaf_votes;
+    vector<double> no_votes;
+    vector<double> yes_votes;
+};
+
+GemmScratch& block_scratch(size_t widest) {
+    thread_local GemmScratch scratch;
+
+    if (scratch.s.size() < GEMM_BLOCK * widest) {
+        scratch.s.resize(GEMM_BLOCK * widest);
+        scratch.p.resize(GEMM_BLOCK * widest);
+    }
+    if (scratch.x.empty()) {
+        scratch.x.resize(GEMM_BLOCK * N_FEATURES);
+        scratch.packed.resize(GEMM_BLOCK);
+        scratch.leaf_votes.resize(GEMM_BLOCK * 2);
+        scratch.no_votes.resize(GEMM_BLOCK);
+        scratch.yes_votes.resize(GEMM_BLOCK);
+    }
+
+    return scratch;
+}
+
+bool all_finite(const FeatureArray& features) {
+    return all_of(features.begin(), features.end(), [](double x) { return isfinite(x); });
+}
+
+}
+
+int GemmForest::predict(const FeatureArray& features) const {
+    int label;
+    this->predict_block(&features, 1, &label);
+    return label;
+}
+
+void GemmForest::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    for (size_t first = 0; first < features.size(); first += GEMM_BLOCK) {
+        const auto count = min(GEMM_BLOCK, features.size() - first);
+        this->predict_block(features.data() + first, count, out.data() + first);
+    }
+}
+
+void GemmForest::predict_block(const FeatureArray* rows, size_t count, int* out) const {
+    auto& scratch = block_scratch(this->widest);
+    auto* x = scratch.x.data();
+    auto* packed = scratch.packed.data();
+    auto* s = scratch.s.data();
+    auto* p = scratch.p.data();
+    auto* leaf_votes = scratch.leaf_votes.data();
+    auto* no_votes = scratch.no_votes.data();
+    auto* yes_votes = scratch.yes_votes.data();
+
+    // Finite rows are packed into x; the others are walked
+    size_t m = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (all_finite(rows[i])) {
+            copy(rows[i].begin(), rows[i].end(), x + m * N_FEATURES);
+            packed[m++] = i;
+        } else {
+            out[i] = predict_arena(this->arena.data(), this->roots.data(), this->roots.size(), this->classes.data(), rows[i]);
+        }
+    }
+
+    if (m == 0) {
+        return;
+    }
+
+    fill_n(no_votes, m, 0.0);
+    fill_n(yes_votes, m, 0.0);
+
+    for (const auto& tree: this->trees) {
+        const auto* a = this->values.data() + tree.a;
+        const auto* b = this->values.data() + tree.b;
+        const auto* c = this->values.data() + tree.c;
+        const auto* d = this->values.data() + tree.d;
+        const auto* v = this->values.data() + tree.v;
+
+        // S = X A, then T = (S <= B) in place
+        gemm(m, tree.internal, N_FEATURES, x, a, s);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < tree.internal; j++) {
+                s[i * tree.internal + j] = s[i * tree.internal + j] <= b[j] ? 1.0 : 0.0;
+            }
+        }
+
+        // P = T C, then the one-hot leaf row (P == D) in place
+        gemm(m, tree.leaves, tree.internal, s, c, p);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t j = 0; j < tree.leaves; j++) {
+                p[i * tree.leaves + j] = p[i * tree.leaves + j] == d[j] ? 1.0 : 0.0;
+            }
+        }
+
+        // Votes = E V, added in tree order
+        gemm(m, 2, tree.leaves, p, v, leaf_votes);
+        for (size_t i = 0; i < m; i++) {
+            no_votes[i] += leaf_votes[2 * i];
+            yes_votes[i] += leaf_votes[2 * i + 1];
+        }
+    }
+
+    for (size_t i = 0; i < m; i++) {
+        out[packed[i]] = yes_votes[i] >= no_votes[i] ? this->classes[1] : this->classes[0];
+    }
+}
+
+GemmForest GemmForest::from_forest(const Forest& forest) {
+    GemmForest gf;
+
+    for (const auto& tree: forest.get_trees()) {
+        const auto& feature = tree.get_feature();
+        const auto& children_left = tree.get_children_left();
+        const auto& children_right = tree.get_children_right();
+        const auto& value = tree.get_value();
+
+        // Column of each internal node in A/B/C, row of each leaf in C/D/V
+        vector<int> column(tree.node_count(), -1);
+        vector<int> leaf_row(tree.node_count(), -1);
+        TreeMatrices m{0, 0, 0, 0, 0, 0, 0};
+
+        for (size_t node = 0; node < tree.node_count(); node++) {
+            if (children_left[node] == -1) {
+                leaf_row[node] = m.leaves++;
+            } else {
+                column[node] = m.internal++;
+            }
+        }
+
+        m.a = gf.values.size();
+        m.b = m.a + N_FEATURES * m.internal;
+        m.c = m.b + m.internal;
+        m.d = m.c + m.internal * m.leaves;
+        m.v = m.d + m.leaves;
+        gf.values.resize(m.v + 2 * m.leaves, 0.0);
+
+        auto* values = gf.values.data();
+
+        // Walk root to leaves keeping the path: (node, internal ancestors
+        // with +1 for a left turn, -1 for a right one)
+        vector<pair<int, vector<pair<int, int>>>> stack = {{0, {}}};
+
+        while (!stack.empty()) {
+            auto [node, path] = move(stack.back());
+            stack.pop_back();
+
+            if (children_left[node] == -1) {
+                const auto row = leaf_row[node];
+                int lefts = 0;
+
+                for (auto [col, turn]: path) {
+                    values[m.c + col * m.leaves + row] = turn;
+                    lefts += turn > 0;
+                }
+
+                values[m.d + row] = lefts;
+                values[m.v + 2 * row] = get<0>(value[node]);
+                values[m.v + 2 * row + 1] = get<1>(value[node]);
+                continue;
+            }
+
+            const auto col = column[node];
+            values[m.a + feature[node] * m.internal + col] = 1.0;
+            values[m.b + col] = tree.bound(node);
+
+            auto right_path = path;
+            right_path.emplace_back(col, -1);
+            path.emplace_back(col, 1);
+
+            stack.emplace_back(children_right[node], move(right_path));
+            stack.emplace_back(children_left[node], move(path));
+        }
+
+        gf.widest = max({gf.widest, m.internal, m.leaves});
+        gf.trees.push_back(m);
+    }
+
+    gf.arena.assign(forest.get_arena(), forest.get_arena() + forest.arena_size());
+    gf.roots = forest.get_roots();
+    gf.classes = forest.get_classes();
+
+    return gf;
+}
@@ -0,0 +1,93 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "Forest.h"
+#include "LookupForest.h"
+#include "Tree.h"
+
+using namespace std;
+
+int LookupForest::predict(const FeatureArray& features) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    const auto n_entries = size_t(1) << this->levels;
+
+    for (size_t t = 0; t < this->roots.size(); t++) {
+        const auto* tests = this->conditions.data() + t * this->n_conditions;
+
+        // Independent comparisons, one bit per heap position
+        uint32_t bits = 0;
+        for (size_t p = 0; p < this->n_conditions; p++) {
+            bits |= uint32_t(!(features[tests[p].feature] <= tests[p].bound)) << p;
+        }
+
+        size_t position = 0;
+        for (size_t level = 0; level < this->levels; level++) {
+            position = 2 * position + 1 + ((bits >> position) & 1);
+        }
+
+        const auto entry = this->entries[t * n_entries + position - this->n_conditions];
+        const auto& vote = this->leaf_votes[compact_leaf(this->nodes.data() + this->roots[t] + entry, features)];
+
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+LookupForest LookupForest::from_forest(const Forest& forest, size_t levels) {
+    if (levels == 0 || levels > MAX_LEVELS) {
+        throw invalid_argument("lookup tables cover 1 to MAX_LEVELS levels");
+    }
+
+    LookupForest lf;
+    lf.levels = levels;
+    lf.n_conditions = (size_t(1) << levels) - 1;
+
+    for (const auto& tree: forest.get_trees()) {
+        const auto& nodes = tree.get_nodes();
+        const auto leaf_base = static_cast<uint32_t>(lf.leaf_votes.size());
+
+        // Compact node at each heap position of the top levels and their exits
+        vector<uint32_t> slot(2 * lf.n_conditions + 1);
+        slot[0] = 0;
+
+        for (size_t p = 0; p < lf.n_conditions; p++) {
+            const auto index = slot[p];
+            const auto& node = nodes[index];
+
+            if (node.feature == COMPACT_LEAF) {
+                // Both ways lead to this leaf
+                lf.conditions.push_back(LookupCondition{INFINITY, 0});
+                slot[2 * p + 1] = index;
+                slot[2 * p + 2] = index;
+            } else {
+                lf.conditions.push_back(LookupCondition{node.bound, node.feature});
+                slot[2 * p + 1] = index + 1;
+                slot[2 * p + 2] = index + node.payload;
+            }
+        }
+
+        lf.entries.insert(lf.entries.end(), slot.begin() + lf.n_conditions, slot.end());
+
+        lf.roots.push_back(lf.nodes.size());
+        for (auto node: nodes) {
+            if (node.feature == COMPACT_LEAF) {
+                node.payload += leaf_base;
+            }
+            lf.nodes.push_back(node);
+        }
+
+        lf.leaf_votes.insert(lf.leaf_votes.end(), tree.get_leaf_votes().begin(), tree.get_leaf_votes().end());
+    }
+
+    lf.classes = forest.get_classes();
+
+    return lf;
+}
@@ -5,21 +5,35 @@
 using json = nlohmann::json;
 using namespace std;
 
-int Predictor::predict(FeatureArray& features) const {
-    this->scaler.transform(features);
-
+int Predictor::predict(const FeatureArray& features) const {
     return forest.predict(features);
 }
 
+void Predictor::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    this->forest.predict_batch(features, out);
+}
+
 void from_json(const json& data, Predictor& p) {
     p.scaler = data.at("scaler").get<Scaler>();
     p.forest = data.at("model").get<Forest>();
+
+    // the forest compares raw features from here on
+    p.forest.fold_scaler(p.scaler);
+    p.forest.optimise();
 }
 
-Predictor Predictor::LoadEmbedded() {
-    std::string s(reinterpret_cast< char const* >(data_model_json));
+json Predictor::EmbeddedJson() {
+    std::string s(reinterpret_cast< char const* >(data_model_json), data_model_json_len);
 
-    json data = json::parse(s);
+    return json::parse(s);
+}
+
+Predictor Predictor::LoadEmbedded() {
+    json data = EmbeddedJson();
 
     return data.get<Predictor>();
 }
+
+MappedModel Predictor::LoadBinary(const std::string& path) {
+    return MappedModel::open(path);
+}
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <stdexcept>
+#include <immintrin.h>
+
+#include "AlignedAllocator.h"
+#include "QuickScorer.h"
+#include "Forest.h"
+#include "Tree.h"
+
+using namespace std;
+
+int QuickScorer::predict(const FeatureArray& features) const {
+    // Reused across calls so single-sample scoring does not hit the allocator
+    thread_local vector<uint64_t> leaves;
+    leaves.assign(this->leaf_offsets.size(), ~uint64_t(0));
+
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        const auto sample = features[f];
+
+        for (auto i = this->offsets[f]; i < this->offsets[f + 1]; i++) {
+            if (sample <= this->bounds[i]) {
+                break;
+            }
+
+            leaves[this->condition_trees[i]] &= this->condition_masks[i];
+        }
+    }
+
+    return this->vote(leaves.data(), 1);
+}
+
+// Sums the exit-leaf votes in tree order; the mask of tree t is leaves[t * stride]
+int QuickScorer::vote(const uint64_t* leaves, size_t stride) const {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (size_t t = 0; t < this->leaf_offsets.size(); t++) {
+        const auto& vote = this->leaf_votes[this->leaf_offsets[t] + __builtin_ctzll(leaves[t * stride])];
+
+        no_votes += vote[0];
+        yes_votes += vote[1];
+    }
+
+    if (yes_votes >= no_votes) {
+        return this->classes[1];
+    } else {
+        return this->classes[0];
+    }
+}
+
+void QuickScorer::predict_batch(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+
+    if (__builtin_cpu_supports("avx512f")) {
+        this->predict_avx512(features, out);
+    } else if (__builtin_cpu_supports("avx2")) {
+        this->predict_avx2(features, out);
+    } else {
+        for (size_t i = 0; i < features.size(); i++) {
+            out[i] = this->predict(features[i]);
+        }
+    }
+}
+
+void QuickScorer::predict_batch_avx2(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+    if (!__builtin_cpu_supports("avx2")) {
+        throw runtime_error("CPU does not support AVX2");
+    }
+
+    this->predict_avx2(features, out);
+}
+
+void QuickScorer::predict_batch_avx512(span<const FeatureArray> features, span<int> out) const {
+    if (features.size() != out.size()) {
+        throw invalid_argument("predict_batch needs one output slot per sample");
+    }
+    if (!__builtin_cpu_supports("avx512f")) {
+        throw runtime_error("CPU does not support AVX-512");
+    }
+
+    this->predict_avx512(features, out);
+}
+
+// The comparison is !(x <= bound) so NaN lanes go right, as in Tree::predict.
+// A block stops scanning a feature once no lane exceeds the current bound.
+__attribute__((target("avx2")))
+void QuickScorer::predict_avx2(span<const FeatureArray> features, span<int> out) const {
+    constexpr size_t lanes = 4;
+    vector<uint64_t, AlignedAllocator<uint64_t>> leaves(this->leaf_offsets.size() * lanes);
+
+    for (size_t start = 0; start < features.size(); start += lanes) {
+        const auto count = min(lanes, features.size() - start);
+        const FeatureArray* block = features.data() + start;
+
+        fill(leaves.begin(), leaves.end(), ~uint64_t(0));
+
+        for (size_t f = 0; f < N_FEATURES; f++) {
+            alignas(32) double samples[lanes];
+            for (size_t lane = 0; lane < lanes; lane++) {
+                samples[lane] = block[min(lane, count - 1)][f];
+            }
+            const __m256d x = _mm256_load_pd(samples);
+
+            for (auto i = this->offsets[f]; i < this->offsets[f + 1]; i++) {
+                const __m256d right = _mm256_cmp_pd(x, _mm256_set1_pd(this->bounds[i]), _CMP_NLE_UQ);
+                if (_mm256_movemask_pd(right) == 0) {
+                    break;
+                }
+
+                auto* mask = reinterpret_cast<__m256i*>(leaves.data() + this->condition_trees[i] * lanes);
+                const __m256i cleared = _mm256_and_si256(
+                    _mm256_castpd_si256(right),
+                    _mm256_set1_epi64x(static_cast<long long>(~this->condition_masks[i]))
+                );
+                _mm256_store_si256(mask, _mm256_andnot_si256(cleared, _mm256_load_si256(mask)));
+            }
+        }
+
+        for (size_t lane = 0; lane < count; lane++) {
+            out[start + lane] = this->vote(leaves.data() + lane, lanes);
+        }
+    }
+}
+
+__attribute__((target("avx512f")))
+void QuickScorer::predict_avx512(span<const FeatureArray> features, span<int> out) const {
+    constexpr size_t lanes = 8;
+    vector<uint64_t, AlignedAllocator<uint64_t>> leaves(this->leaf_offsets.size() * lanes);
+
+    for (size_t start = 0; start < features.size(); start += lanes) {
+        const auto count = min(lanes, features.size() - start);
+        const FeatureArray* block = features.data() + start;
+
+        fill(leaves.begin(), leaves.end(), ~uint64_t(0));
+
+        for (size_t f = 0; f < N_FEATURES; f++) {
+            alignas(64) double samples[lanes];
+            for (size_t lane = 0; lane < lanes; lane++) {
+                samples[lane] = block[min(lane, count - 1)][f];
+            }
+            const __m512d x = _mm512_load_pd(samples);
+
+            for (auto i = this->offsets[f]; i < this->offsets[f + 1]; i++) {
+                const __mmask8 right = _mm512_cmp_pd_mask(x, _mm512_set1_pd(this->bounds[i]), _CMP_NLE_UQ);
+                if (right == 0) {
+                    break;
+                }
+
+                auto* mask = leaves.data() + this->condition_trees[i] * lanes;
+                const __m512i current = _mm512_load_si512(mask);
+                _mm512_store_si512(mask, _mm512_mask_and_epi64(
+                    current, right, current, _mm512_set1_epi64(static_cast<long long>(this->condition_masks[i]))
+                ));
+            }
+        }
+
+        for (size_t lane = 0; lane < count; lane++) {
+            out[start + lane] = this->vote(leaves.data() + lane, lanes);
+        }
+    }
+}
+
+namespace {
+
+struct Condition {
+    double bound;
+    uint32_t tree;
+    uint64_t mask;
+};
+
+// Numbers the leaves under `node` left to right starting at `next_leaf`,
+// appending one condition per internal node to `conditions[feature]`.
+// Returns the mask of leaves under `node`.
+uint64_t collect_conditions(
+    const Tree& tree,
+    uint32_t tree_index,
+    int node,
+    int& next_leaf,
+    vector<array<double, 2>>& leaf_votes,
+    vector<vector<Condition>>& conditions
+) {
+    const auto& children_left = tree.get_children_left();
+
+    if (children_left[node] == -1) {
+        if (next_leaf == 64) {
+            throw invalid_argument("QuickScorer supports at most 64 leaves per tree");
+        }
+
+        const auto& value = tree.get_value()[node];
+        leaf_votes.push_back({get<0>(value), get<1>(value)});
+
+        return uint64_t(1) << next_leaf++;
+    }
+
+    auto left = collect_conditions(tree, tree_index, children_left[node], next_leaf, leaf_votes, conditions);
+    auto right = collect_conditions(tree, tree_index, tree.get_children_right()[node], next_leaf, leaf_votes, conditions);
+
+    // When the sample goes right, no leaf of the left subtree can be the exit
+    conditions[tree.get_feature()[node]].push_back(Condition{
+        tree.bound(node), tree_index, ~left
+    });
+
+    return left | right;
+}
+
+}
+
+QuickScorer QuickScorer::from_forest(const Forest& forest) {
+    QuickScorer qs;
+    vector<vector<Condition>> conditions(N_FEATURES);
+
+    const auto& trees = forest.get_trees();
+    for (uint32_t t = 0; t < trees.size(); t++) {
+        int next_leaf = 0;
+
+        qs.leaf_offsets.push_back(qs.leaf_votes.size());
+        collect_conditions(trees[t], t, 0, next_leaf, qs.leaf_votes, conditions);
+    }
+
+    qs.offsets[0] = 0;
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        auto& list = conditions[f];
+
+        stable_sort(list.begin(), list.end(), [](const Condition& a, const Condition& b) {
+            return a.bound < b.bound;
+        });
+
+        for (const auto& condition: list) {
+            qs.bounds.push_back(condition.bound);
+            qs.condition_trees.push_back(condition.tree);
+            qs.condition_masks.push_back(condition.mask);
+        }
+
+        qs.offsets[f + 1] = qs.bounds.size();
+    }
+
+    qs.classes = forest.get_classes();
+
+    return qs;
+}
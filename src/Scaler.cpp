@@ -1,7 +1,61 @@
-﻿#include "Scaler.h"
+﻿#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Scaler.h"
+
+using namespace std;
 
 void Scaler::transform(FeatureArray& data) const {
     for (size_t i = 0; i < N_FEATURES; i++) {
         data[i] = (data[i] - this->mean[i]) / this->scale[i];
     }
 }
+
+namespace {
+
+// Maps doubles onto integers in the same order (-0.0 and 0.0 share a key)
+int64_t order_key(double x) {
+    auto bits = bit_cast<int64_t>(x);
+    return bits >= 0 ? bits : -(bits & INT64_MAX);
+}
+
+double from_order_key(int64_t key) {
+    return key >= 0 ? bit_cast<double>(key) : bit_cast<double>(-key | INT64_MIN);
+}
+
+}
+
+double Scaler::raw_bound(size_t feature, double bound) const {
+    const auto mean = this->mean[feature];
+    const auto scale = this->scale[feature];
+
+    if (!(scale > 0.0)) {
+        throw invalid_argument("raw_bound needs a positive scale");
+    }
+
+    // (x - mean) / scale is monotone in x, so bisect over the ordered doubles
+    // for the last one that still lands at or below the bound
+    auto goes_left = [&](double x) { return (x - mean) / scale <= bound; };
+
+    if (goes_left(INFINITY)) {
+        return INFINITY;
+    }
+
+    auto lo = order_key(-INFINITY);
+    auto hi = order_key(INFINITY);
+
+    // the key range spans more than INT64_MAX, so halve before adding
+    while (lo + 1 < hi) {
+        auto mid = (lo >> 1) + (hi >> 1) + (lo & hi & 1);
+
+        if (goes_left(from_order_key(mid))) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return from_order_key(lo);
+}
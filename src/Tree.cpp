@@ -1,29 +1,220 @@
-﻿#include <cmath>
+﻿#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
+#include "Scaler.h"
 #include "Tree.h"
 
 using json = nlohmann::json;
 using namespace std;
 
 tuple<double, double> Tree::predict(const FeatureArray& features) const {
-    auto node = 0;
+    const auto& vote = this->leaf_votes[compact_leaf(this->nodes.data(), features)];
 
-    while (this->children_left[node] != -1) {
-        const auto feature = this->feature[node];
-        const auto sample = features[feature];
+    return make_tuple(vote[0], vote[1]);
+}
+
+// Renumbers the nodes in preorder with an explicit stack, so that a left
+// child always directly follows its parent
+void Tree::build_nodes() {
+    this->nodes.clear();
+    this->leaf_votes.clear();
+
+    // (tree node, index of the parent whose right offset it fills, or -1)
+    vector<pair<int, int>> stack = {{0, -1}};
+
+    while (!stack.empty()) {
+        const auto [node, parent] = stack.back();
+        stack.pop_back();
+
+        const auto index = static_cast<uint32_t>(this->nodes.size());
+        if (parent != -1) {
+            this->nodes[parent].payload = index - parent;
+        }
+
+        if (this->children_left[node] == -1) {
+            this->nodes.push_back(CompactNode{0.0, static_cast<uint32_t>(this->leaf_votes.size()), COMPACT_LEAF});
+            this->leaf_votes.push_back({get<0>(this->value[node]), get<1>(this->value[node])});
+            continue;
+        }
+
+        if (this->feature[node] < 0 || this->feature[node] >= COMPACT_LEAF) {
+            throw invalid_argument("tree feature index out of range");
+        }
+
+        this->nodes.push_back(CompactNode{this->bound(node), 0, static_cast<uint8_t>(this->feature[node])});
+
+        // the left child is visited next, the right one once its subtree is done
+        stack.emplace_back(this->children_right[node], index);
+        stack.emplace_back(this->children_left[node], -1);
+    }
+}
+
+double Tree::left_bound(double threshold) {
+    // x - threshold is monotone in x, so the values within epsilon above the
+    // threshold form one interval; walk to its upper end.
+    auto bound = threshold + 1e-5;
+
+    while (bound - threshold >= 1e-5) {
+        bound = nextafter(bound, -INFINITY);
+    }
+
+    while (nextafter(bound, INFINITY) - threshold < 1e-5) {
+        bound = nextafter(bound, INFINITY);
+    }
+
+    return bound;
+}
+
+void Tree::fold_epsilon() {
+    if (this->folded) {
+        return;
+    }
+
+    for (size_t node = 0; node < this->threshold.size(); node++) {
+        if (this->children_left[node] != -1) {
+            this->threshold[node] = left_bound(this->threshold[node]);
+        }
+    }
+
+    this->folded = true;
+    this->build_nodes();
+}
+
+void Tree::fold_scaler(const Scaler& scaler) {
+    if (this->folded) {
+        throw logic_error("fold_scaler needs thresholds in scaled space");
+    }
+
+    this->fold_epsilon();
+
+    for (size_t node = 0; node < this->threshold.size(); node++) {
+        if (this->children_left[node] != -1) {
+            this->threshold[node] = scaler.raw_bound(this->feature[node], this->threshold[node]);
+        }
+    }
+
+    this->build_nodes();
+}
+
+// Samples reaching `node` satisfy lo[f] < x <= hi[f] for every feature f,
+// where an infinite end means no test on that side yet. NaN always goes
+// right, so it only reaches nodes without a finite hi.
+int Tree::simplify_node(
+    int node, vector<double>& lo, vector<double>& hi,
+    bool prune_dead, bool collapse_identical, SimplifyStats& stats
+) {
+    if (this->children_left[node] == -1) {
+        return node;
+    }
 
-        const auto threshold = this->threshold[node];
+    const auto f = this->feature[node];
+    const auto b = this->bound(node);
 
-        if (sample <= threshold || abs(sample - threshold) < 1e-5) {
-            node = this->children_left[node];
-        } else {
-            node = this->children_right[node];
+    if (prune_dead) {
+        if (hi[f] < INFINITY && hi[f] <= b) {
+            stats.dead++;
+            return this->simplify_node(this->children_left[node], lo, hi, prune_dead, collapse_identical, stats);
+        } else if (lo[f] > -INFINITY && b <= lo[f]) {
+            stats.dead++;
+            return this->simplify_node(this->children_right[node], lo, hi, prune_dead, collapse_identical, stats);
         }
     }
 
-    tuple<double, double> value = this->value[node];
+    const auto upper = hi[f];
+    hi[f] = min(upper, b);
+    const auto left = this->simplify_node(this->children_left[node], lo, hi, prune_dead, collapse_identical, stats);
+    hi[f] = upper;
 
-    return value;
+    const auto lower = lo[f];
+    lo[f] = max(lower, b);
+    const auto right = this->simplify_node(this->children_right[node], lo, hi, prune_dead, collapse_identical, stats);
+    lo[f] = lower;
+
+    // Identical subtrees map every sample to the same leaf value, so the
+    // test in front of them does not matter
+    if (collapse_identical && this->same_subtree(left, right)) {
+        stats.collapsed++;
+        return left;
+    }
+
+    this->children_left[node] = left;
+    this->children_right[node] = right;
+
+    return node;
+}
+
+bool Tree::same_subtree(int a, int b) const {
+    if (a == b) {
+        return true;
+    }
+
+    const bool leaf = this->children_left[a] == -1;
+    if (leaf != (this->children_left[b] == -1)) {
+        return false;
+    } else if (leaf) {
+        return this->value[a] == this->value[b];
+    }
+
+    return this->feature[a] == this->feature[b]
+        && this->bound(a) == this->bound(b)
+        && this->same_subtree(this->children_left[a], this->children_left[b])
+        && this->same_subtree(this->children_right[a], this->children_right[b]);
+}
+
+SimplifyStats Tree::simplify(bool prune_dead, bool collapse_identical) {
+    SimplifyStats stats;
+
+    const auto n_features = *max_element(this->feature.begin(), this->feature.end()) + 1;
+    vector<double> lo(max(n_features, 0), -INFINITY);
+    vector<double> hi(max(n_features, 0), INFINITY);
+
+    const auto root = this->simplify_node(0, lo, hi, prune_dead, collapse_identical, stats);
+
+    // Copy the nodes still reachable from `root` out in preorder
+    vector<int> order;
+    vector<int> renumbered(this->feature.size(), -1);
+    vector<int> stack = {root};
+
+    while (!stack.empty()) {
+        const auto node = stack.back();
+        stack.pop_back();
+
+        renumbered[node] = static_cast<int>(order.size());
+        order.push_back(node);
+
+        if (this->children_left[node] != -1) {
+            stack.push_back(this->children_right[node]);
+            stack.push_back(this->children_left[node]);
+        }
+    }
+
+    Tree simplified;
+    simplified.folded = this->folded;
+
+    for (auto node: order) {
+        const bool leaf = this->children_left[node] == -1;
+
+        simplified.feature.push_back(this->feature[node]);
+        simplified.threshold.push_back(this->threshold[node]);
+        simplified.children_left.push_back(leaf ? -1 : renumbered[this->children_left[node]]);
+        simplified.children_right.push_back(leaf ? -1 : renumbered[this->children_right[node]]);
+        simplified.value.push_back(this->value[node]);
+
+        if (!this->n_node_samples.empty()) {
+            simplified.n_node_samples.push_back(this->n_node_samples[node]);
+        }
+    }
+
+    simplified.build_nodes();
+    *this = move(simplified);
+
+    return stats;
+}
+
+void Tree::drop_node_samples() {
+    this->n_node_samples.clear();
+    this->n_node_samples.shrink_to_fit();
 }
 
 void to_json(json& j, const Tree& t) {
@@ -40,9 +231,16 @@ void to_json(json& j, const Tree& t) {
         {"threshold", t.threshold},
         {"children_left", t.children_left},
         {"children_right", t.children_right},
-        {"value", value},
-        {"n_node_samples", t.n_node_samples}
+        {"value", value}
     };
+
+    if (!t.n_node_samples.empty()) {
+        j["n_node_samples"] = t.n_node_samples;
+    }
+
+    if (t.folded) {
+        j["folded"] = true;
+    }
 }
 
 void from_json(const json& j, Tree& t) {
@@ -50,7 +248,13 @@ void from_json(const json& j, Tree& t) {
     j.at("threshold").get_to(t.threshold);
     j.at("children_left").get_to(t.children_left);
     j.at("children_right").get_to(t.children_right);
-    j.at("n_node_samples").get_to(t.n_node_samples);
+    if (j.contains("n_node_samples")) {
+        j.at("n_node_samples").get_to(t.n_node_samples);
+    }
+
+    if (j.contains("folded")) {
+        j.at("folded").get_to(t.folded);
+    }
 
     auto value = j
         .at("value")
@@ -60,4 +264,6 @@ void from_json(const json& j, Tree& t) {
         tuple<double, double> tup = make_tuple(vv[0][0], vv[0][1]);
         t.value.push_back(tup);
     }
+
+    t.build_nodes();
 }
@@ -1,5 +1,7 @@
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <stdio.h>
 #include <vector>
 #include <string>
@@ -7,30 +9,95 @@
 #include "Sample.h"
 #include "Predictor.h"
 
+#ifdef PP_COMPILED_MODEL
+#include "CompiledModel.h"
+#else
+#include "model_tables.h"
+#endif
+
 using namespace std;
 
 vector<Sample> csv_to_samples(ifstream& fin);
 
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        printf("usage: %s <sample_csv>\n", argv[0]);
+    auto engine = Forest::Engine::Arena;
+    string model_file = "";
+    size_t lookup_levels = LookupForest::DEFAULT_LEVELS;
+
+    int arg = 1;
+    try {
+        for (; arg + 1 < argc; arg += 2) {
+            string option = argv[arg];
+
+            if (option == "--engine") {
+                engine = Forest::engine_from_name(argv[arg + 1]);
+            } else if (option == "--model") {
+                model_file = argv[arg + 1];
+            } else if (option == "--lookup-levels") {
+                lookup_levels = strtoul(argv[arg + 1], nullptr, 10);
+                if (lookup_levels == 0 || lookup_levels > LookupForest::MAX_LEVELS) {
+                    throw invalid_argument("--lookup-levels takes 1 to " + to_string(LookupForest::MAX_LEVELS));
+                }
+            } else {
+                break;
+            }
+        }
+    } catch (const invalid_argument& e) {
+        printf("%s\n", e.what());
+        return -1;
+    }
+
+    if (arg != argc - 1 || (!model_file.empty() && engine != Forest::Engine::Arena)) {
+        printf("usage: %s [--engine arena|quickscorer|branchless|compact|binned|gather|gemm|lookup [--lookup-levels 1-5] | --model <binary_model>] <sample_csv>\n", argv[0]);
         return -1;
     }
 
     // get the samples
-    auto sample_file = argv[1];
+    auto sample_file = argv[argc - 1];
     ifstream sample_fin(sample_file);
     auto samples = csv_to_samples(sample_fin);
 
-    auto predictor = Predictor::LoadEmbedded();
-
-    int he = 0;
-    // run the forest
+    vector<FeatureArray> rows;
+    rows.reserve(samples.size());
     for (const auto& sample : samples) {
-        auto sarr = sample.to_array();
+        rows.push_back(sample.to_array());
+    }
+
+    vector<int> labels(rows.size());
+
+#ifdef PP_COMPILED_MODEL
+    // the model is compiled in, there is nothing to load
+    (void)engine;
+    (void)model_file;
+    (void)lookup_levels;
+
+    compiled_model::predict_batch(rows, labels);
+#else
+    if (!model_file.empty()) {
+        // mapped binary model, walked in place
+        try {
+            auto model = Predictor::LoadBinary(model_file);
+            model.predict_batch(rows, labels);
+        } catch (const runtime_error& e) {
+            printf("%s\n", e.what());
+            return -1;
+        }
+    } else if (engine == Forest::Engine::Arena) {
+        // constinit tables, again nothing to load or parse
+        embedded_model.predict_batch(rows, labels);
+    } else {
+        auto predictor = Predictor::LoadEmbedded();
+        predictor.set_lookup_levels(lookup_levels);
+        predictor.set_engine(engine);
 
-        auto p = predictor.predict(sarr);
-        he += p;
+        // run the forest
+        predictor.predict_batch(rows, labels);
+    }
+#endif
+
+    int he = 0;
+    for (auto label : labels) {
+        he += label;
     }
 
     cout << he << endl;
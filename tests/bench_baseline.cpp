@@ -1,4 +1,9 @@
 #include <catch.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
 #include <vector>
 #include <fstream>
 #include "Sample.h"
@@ -6,11 +11,27 @@
 #include "Tree.h"
 #include "Forest.h"
 #include "Predictor.h"
+#include "CompactForest.h"
+#include "FloatForest.h"
+#include "GemmForest.h"
+#include "LookupForest.h"
+#include "model_tables.h"
+
+#ifdef PP_COMPILED_MODEL
+#include "CompiledModel.h"
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // Load real test data
-static std::vector<Sample> load_test_samples() {
+static std::vector<Sample> load_test_samples(const std::string& path = "data/TrainDataTest10s.csv") {
     std::vector<Sample> samples;
-    std::ifstream fin("data/TrainDataTest10s.csv");
+    std::ifstream fin(path);
 
     if (!fin.is_open()) {
         // Return empty vector if file not found - tests will handle gracefully
@@ -29,11 +50,131 @@ static std::vector<Sample> load_test_samples() {
     return samples;
 }
 
-TEST_CASE("Benchmark: Sample::to_vec()", "[bench][baseline][sample]") {
+static std::vector<FeatureArray> to_rows(const std::vector<Sample>& samples) {
+    std::vector<FeatureArray> rows;
+    rows.reserve(samples.size());
+
+    for (const auto& sample : samples) {
+        rows.push_back(sample.to_array());
+    }
+
+    return rows;
+}
+
+static int sum_labels(const std::vector<int>& labels) {
+    int sum = 0;
+    for (auto label : labels) {
+        sum += label;
+    }
+    return sum;
+}
+
+// Prints rows per second of `score`, which processes `rows` samples per call
+template <typename F>
+static void report_rows_per_second(const char* name, size_t rows, F&& score, int repeats = 200) {
+    int sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+        sink += score();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%-40s %12.0f rows/s (checksum %d)\n", name, rows * repeats / elapsed.count(), sink);
+}
+
+// One hardware event counted on this thread in user space. valid() is false
+// where the kernel or the machine exposes no such counter.
+class PerfCounter {
+    int fd = -1;
+public:
+    PerfCounter([[maybe_unused]] uint32_t type, [[maybe_unused]] uint64_t config) {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        this->fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    ~PerfCounter() {
+#ifdef __linux__
+        if (this->fd != -1) {
+            close(this->fd);
+        }
+#endif
+    }
+
+    bool valid() const { return this->fd != -1; }
+
+    void start() {
+#ifdef __linux__
+        ioctl(this->fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(this->fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t count = 0;
+#ifdef __linux__
+        ioctl(this->fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(this->fd, &count, sizeof(count)) != sizeof(count)) {
+            count = 0;
+        }
+#endif
+        return count;
+    }
+};
+
+// Set-associative LRU model of a data cache with 64-byte lines, fed the
+// addresses a walk loads. Stands in for the hardware counters on hosts
+// without them; it only sees the loads it is given.
+class CacheModel {
+    size_t ways;
+    size_t sets;
+    std::vector<uint64_t> lines;    // per set, most recently used first
+public:
+    size_t accesses = 0;
+    size_t misses = 0;
+
+    CacheModel(size_t bytes, size_t ways)
+        : ways(ways), sets(bytes / 64 / ways), lines(bytes / 64, ~uint64_t(0)) {}
+
+    void load(const void* address) {
+        const auto line = reinterpret_cast<uintptr_t>(address) / 64;
+        auto* set = this->lines.data() + (line % this->sets) * this->ways;
+        auto* end = set + this->ways;
+
+        auto* hit = std::find(set, end, line);
+        this->accesses++;
+        if (hit == end) {
+            this->misses++;
+            hit = end - 1;
+        }
+
+        std::copy_backward(set, hit, hit + 1);
+        set[0] = line;
+    }
+
+    void reset_counts() {
+        this->accesses = 0;
+        this->misses = 0;
+    }
+};
+
+TEST_CASE("Benchmark: Sample::to_array()", "[bench][baseline][sample]") {
     Sample sample{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0};
 
-    BENCHMARK("to_vec() allocation overhead") {
-        return sample.to_vec();
+    BENCHMARK("to_array() conversion") {
+        return sample.to_array();
     };
 }
 
@@ -68,40 +209,542 @@ TEST_CASE("Benchmark: Forest::predict()", "[bench][baseline][forest]") {
     };
 }
 
+TEST_CASE("Benchmark: Single-sample latency, interleaved trees", "[bench][baseline][forest][interleave]") {
+    auto predictor = Predictor::LoadEmbedded();
+    const Forest& forest = predictor.get_forest();
+    auto rows = to_rows(load_test_samples());
+
+    if (!rows.empty()) {
+        // Percentiles of one predict per row, over a few passes of the file
+        auto latency = [&](const char* name, auto&& predict) {
+            std::vector<double> ns;
+            int sink = 0;
+
+            for (int pass = 0; pass < 20; pass++) {
+                for (const auto& features : rows) {
+                    auto start = std::chrono::steady_clock::now();
+                    sink += predict(features);
+                    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                    ns.push_back(elapsed.count());
+                }
+            }
+
+            std::sort(ns.begin(), ns.end());
+            std::printf("%-28s p50 %8.0f ns  p99 %8.0f ns (checksum %d)\n",
+                name, ns[ns.size() / 2], ns[ns.size() * 99 / 100], sink);
+        };
+
+        latency("sequential trees", [&](const FeatureArray& features) {
+            return predict_arena(
+                forest.get_arena(), forest.get_roots().data(), forest.get_roots().size(),
+                forest.get_classes().data(), features
+            );
+        });
+
+        for (size_t group : {4, 8, 12, 16}) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "interleaved, %zu trees", group);
+
+            latency(name, [&](const FeatureArray& features) {
+                return predict_arena_interleaved(
+                    forest.get_arena(), forest.get_roots().data(), forest.get_roots().size(),
+                    forest.get_classes().data(), features, group
+                );
+            });
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Predictor construction", "[bench][baseline][startup]") {
+    BENCHMARK("LoadEmbedded() (JSON parse)") {
+        return Predictor::LoadEmbedded();
+    };
+
+    auto features = FeatureArray{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0};
+    BENCHMARK("forest prediction (constinit tables)") {
+        return embedded_model.predict(features);
+    };
+}
+
+TEST_CASE("Benchmark: Forest engines", "[bench][baseline][forest][engine]") {
+    auto predictor = Predictor::LoadEmbedded();
+    auto rows = to_rows(load_test_samples());
+    std::vector<int> labels(rows.size());
+
+    for (auto name : {"arena", "branchless", "quickscorer", "compact", "binned", "gather", "gemm", "lookup"}) {
+        Forest forest = predictor.get_forest();
+        forest.set_engine(Forest::engine_from_name(name));
+
+        auto features = FeatureArray{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0};
+        BENCHMARK(std::string("forest prediction (") + name + " engine)") {
+            return forest.predict(features);
+        };
+
+        if (!rows.empty()) {
+            BENCHMARK(std::string("bulk prediction throughput (") + name + " engine)") {
+                forest.predict_batch(rows, labels);
+                return sum_labels(labels);
+            };
+        }
+    }
+}
+
 TEST_CASE("Benchmark: End-to-end prediction pipeline", "[bench][baseline][integration]") {
     auto samples = load_test_samples();
 
     if (!samples.empty()) {
         auto predictor = Predictor::LoadEmbedded();
+        std::vector<int> labels(samples.size());
 
         BENCHMARK_ADVANCED("complete prediction pipeline")(Catch::Benchmark::Chronometer meter) {
             meter.measure([&]() {
-                int result = 0;
-                for (const auto& sample : samples) {
-                    auto svec = sample.to_array();
-                    result += predictor.predict(svec);
-                }
-                return result;
+                auto rows = to_rows(samples);
+                predictor.predict_batch(rows, labels);
+                return sum_labels(labels);
             });
         };
     }
 }
 
 TEST_CASE("Benchmark: Bulk predictions with real data", "[bench][baseline][bulk]") {
+    auto rows = to_rows(load_test_samples());
+
+    if (!rows.empty()) {
+        auto predictor = Predictor::LoadEmbedded();
+        std::vector<int> labels(rows.size());
+
+        auto arena_batch = [&]() {
+            predictor.predict_batch(rows, labels);
+            return sum_labels(labels);
+        };
+
+        BENCHMARK_ADVANCED("bulk prediction throughput")(Catch::Benchmark::Chronometer meter) {
+            meter.measure(arena_batch);
+        };
+
+        auto qs_predictor = predictor;
+        qs_predictor.set_engine(Forest::Engine::QuickScorer);
+
+        auto qs_batch = [&]() {
+            qs_predictor.predict_batch(rows, labels);
+            return sum_labels(labels);
+        };
+
+        BENCHMARK_ADVANCED("bulk prediction throughput (V-QuickScorer batch)")(Catch::Benchmark::Chronometer meter) {
+            meter.measure(qs_batch);
+        };
+
+        report_rows_per_second("arena batch (src/main.cpp)", rows.size(), arena_batch);
+        report_rows_per_second("V-QuickScorer batch", rows.size(), qs_batch);
+
+#ifdef PP_COMPILED_MODEL
+        auto compiled = [&]() {
+            compiled_model::predict_batch(rows, labels);
+            return sum_labels(labels);
+        };
+
+        BENCHMARK_ADVANCED("bulk prediction throughput (compiled model)")(Catch::Benchmark::Chronometer meter) {
+            meter.measure(compiled);
+        };
+
+        report_rows_per_second("compiled model", rows.size(), compiled);
+#endif
+    }
+}
+
+TEST_CASE("Benchmark: Arena tile sweep", "[bench][baseline][bulk][tiling]") {
     auto samples = load_test_samples();
 
     if (!samples.empty()) {
+        Forest forest = Predictor::LoadEmbedded().get_forest();
+
+        // Repeat the test rows so every sample tile size gets many blocks
+        auto rows = to_rows(samples);
+        while (rows.size() < 20000) {
+            rows.insert(rows.end(), rows.begin(), rows.begin() + std::min(rows.size(), 20000 - rows.size()));
+        }
+        std::vector<int> labels(rows.size());
+
+        for (size_t trees : {1, 4, 8, 16, 32, 120}) {
+            for (size_t sample_tile : {8, 32, 128, 512}) {
+                forest.set_tiling({trees, sample_tile});
+
+                char name[64];
+                std::snprintf(name, sizeof(name), "arena tiles %zu trees x %zu rows", trees, sample_tile);
+                report_rows_per_second(name, rows.size(), [&]() {
+                    forest.predict_batch(rows, labels);
+                    return sum_labels(labels);
+                }, 5);
+            }
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Group-prefetch batch", "[bench][baseline][bulk][amac]") {
+    auto samples = load_test_samples();
+
+    if (!samples.empty()) {
+        Forest forest = Predictor::LoadEmbedded().get_forest();
+        const auto* arena = forest.get_arena();
+        const auto& roots = forest.get_roots();
+        const auto* classes = forest.get_classes().data();
+
+        // Enough rows that the input alone outgrows L2
+        auto rows = to_rows(samples);
+        while (rows.size() < 50000) {
+            rows.insert(rows.end(), rows.begin(), rows.begin() + std::min(rows.size(), 50000 - rows.size()));
+        }
+        std::vector<int> labels(rows.size());
+
+        report_rows_per_second("per-sample loop", rows.size(), [&]() {
+            for (size_t i = 0; i < rows.size(); i++) {
+                labels[i] = predict_arena(arena, roots.data(), roots.size(), classes, rows[i]);
+            }
+            return sum_labels(labels);
+        }, 5);
+
+        report_rows_per_second("tiled batch (src/main.cpp)", rows.size(), [&]() {
+            predict_arena_batch(arena, roots.data(), roots.size(), classes, rows, labels);
+            return sum_labels(labels);
+        }, 5);
+
+        for (size_t group : {2, 4, 8, 16, 32, 64}) {
+            char name[64];
+            std::snprintf(name, sizeof(name), "group prefetch, %zu in flight", group);
+            report_rows_per_second(name, rows.size(), [&]() {
+                predict_arena_amac(arena, roots.data(), roots.size(), classes, rows, labels, group);
+                return sum_labels(labels);
+            }, 5);
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Deadline-bounded prediction", "[bench][baseline][anytime]") {
+    auto rows = to_rows(load_test_samples());
+
+    if (!rows.empty()) {
         auto predictor = Predictor::LoadEmbedded();
+        std::vector<int> labels(rows.size());
+        predictor.predict_batch(rows, labels);
 
-        BENCHMARK_ADVANCED("bulk prediction throughput")(Catch::Benchmark::Chronometer meter) {
-            meter.measure([&]() {
+        for (auto budget : {250, 1000, 4000, 16000}) {
+            size_t trees = 0;
+            size_t agree = 0;
+
+            for (size_t i = 0; i < rows.size(); i++) {
+                auto vote = predictor.predict_within(rows[i], std::chrono::nanoseconds(budget));
+                trees += vote.trees_used;
+                agree += vote.label == labels[i];
+            }
+
+            std::printf("predict_within %6d ns: %6.1f trees/row, %5.1f%% of labels match\n",
+                budget, double(trees) / rows.size(), 100.0 * agree / rows.size());
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Two-stage cascade", "[bench][baseline][cascade]") {
+    auto rows = to_rows(load_test_samples());
+
+    if (!rows.empty()) {
+        Forest forest = Predictor::LoadEmbedded().get_forest();
+
+        // Calibrate on the first half, score the held-out second half
+        const auto half = rows.size() / 2;
+        std::span<const FeatureArray> calibration(rows.data(), half);
+        std::span<const FeatureArray> held_out(rows.data() + half, rows.size() - half);
+
+        std::vector<int> expected(held_out.size());
+        forest.predict_batch(held_out, expected);
+
+        report_rows_per_second("full forest", held_out.size(), [&]() {
+            std::vector<int> labels(held_out.size());
+            forest.predict_batch(held_out, labels);
+            return sum_labels(labels);
+        }, 20);
+
+        for (size_t k : {5, 10, 20, 40, 60}) {
+            forest.set_cascade(forest.calibrate_cascade(calibration, k));
+
+            std::vector<int> labels(held_out.size());
+            forest.predict_batch(held_out, labels);
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < labels.size(); i++) {
+                mismatches += labels[i] != expected[i];
+            }
+
+            auto stats = forest.cascade_stats(held_out);
+            std::printf("cascade K=%-3zu %5.1f%% passed to stage 2, %6.1f trees/row, %zu held-out mismatches\n",
+                k, 100.0 * stats.passed / stats.rows, stats.mean_trees, mismatches);
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "cascade K=%zu", k);
+            report_rows_per_second(name, held_out.size(), [&]() {
+                forest.predict_batch(held_out, labels);
+                return sum_labels(labels);
+            }, 20);
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Load-time optimiser passes", "[bench][baseline][optimise]") {
+    const auto data = Predictor::EmbeddedJson();
+    const auto scaler = data.at("scaler").get<Scaler>();
+
+    Forest folded = data.at("model").get<Forest>();
+    folded.fold_scaler(scaler);
+
+    const std::pair<const char*, OptimiseOptions> configs[] = {
+        {"no passes", {false, false, false, false, false, false}},
+        {"dead-node pruning", {false, true, false, false, false, false}},
+        {"identical-subtree collapsing", {false, false, true, false, false, false}},
+        {"leaf margins", {false, false, false, false, true, false}},
+        {"shared subtrees (DAG)", {false, false, false, false, false, true}},
+        {"all passes", {}}
+    };
+
+    auto rows = to_rows(load_test_samples());
+
+    for (const auto& [name, options] : configs) {
+        Forest forest = folded;
+        auto report = forest.optimise(options);
+
+        std::printf("%-30s %zu -> %zu nodes (%zu dead, %zu collapsed), arena %zu -> %zu slots (%zu KB)\n",
+            name, report.nodes_before, report.nodes_after, report.dead_removed, report.collapsed,
+            report.arena_before, report.arena_after, report.arena_after * sizeof(ForestNode) / 1024);
+
+        if (!rows.empty()) {
+            report_rows_per_second(name, rows.size(), [&]() {
+                std::vector<int> labels(rows.size());
+                forest.predict_batch(rows, labels);
+                return sum_labels(labels);
+            }, 20);
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Float32 model", "[bench][baseline][float32]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    CompactForest compact = CompactForest::from_forest(forest);
+    FloatForest ff = FloatForest::from_forest(forest);
+
+    const auto& rounding = ff.get_rounding();
+    std::printf("float32 thresholds: %zu of %zu exact for every double input, %zu float-only\n",
+        rounding.exact, rounding.nodes, rounding.inexact.size());
+    std::printf("node bytes: %zu KB double compact, %zu KB float32\n",
+        compact.node_count() * sizeof(CompactNode) / 1024, ff.node_count() * sizeof(FloatNode) / 1024);
+
+    auto rows = to_rows(load_test_samples());
+
+    if (!rows.empty()) {
+        std::vector<FeatureArrayF> float_rows;
+        for (const auto& row : rows) {
+            float_rows.push_back(to_float(row));
+        }
+
+        std::vector<int> expected(rows.size());
+        std::vector<int> labels(rows.size());
+        forest.predict_batch(rows, expected);
+        ff.predict_batch(float_rows, labels);
+
+        size_t agree = 0;
+        for (size_t i = 0; i < rows.size(); i++) {
+            agree += labels[i] == expected[i];
+        }
+        std::printf("float32 labels match the double forest on %zu of %zu rows\n", agree, rows.size());
+
+        report_rows_per_second("compact (double)", rows.size(), [&]() {
+            compact.predict_batch(rows, labels);
+            return sum_labels(labels);
+        }, 20);
+        report_rows_per_second("float32 scalar", rows.size(), [&]() {
+            for (size_t i = 0; i < float_rows.size(); i++) {
+                labels[i] = ff.predict(float_rows[i]);
+            }
+            return sum_labels(labels);
+        }, 20);
+        if (__builtin_cpu_supports("avx2")) {
+            report_rows_per_second("float32 AVX2 (8 lanes)", rows.size(), [&]() {
+                ff.predict_batch_avx2(float_rows, labels);
+                return sum_labels(labels);
+            }, 20);
+        }
+    }
+}
+
+TEST_CASE("Benchmark: GEMM engine crossover", "[bench][baseline][gemm]") {
+    auto samples = load_test_samples();
+
+    if (!samples.empty()) {
+        Forest forest = Predictor::LoadEmbedded().get_forest();
+        GemmForest gemm = GemmForest::from_forest(forest);
+
+        auto rows = to_rows(samples);
+        while (rows.size() < 4096) {
+            rows.insert(rows.end(), rows.begin(), rows.begin() + std::min(rows.size(), 4096 - rows.size()));
+        }
+
+        std::printf("GEMM matrices: %zu KB\n", gemm.matrix_size() * sizeof(double) / 1024);
+
+        // Rows per second of each engine on batches of `n` rows
+        auto rate = [&](auto&& predict_batch, size_t n) {
+            std::span<const FeatureArray> batch(rows.data(), n);
+            std::vector<int> labels(n);
+            const int repeats = std::max<int>(1, 4096 / n);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < repeats; i++) {
+                predict_batch(batch, labels);
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            return n * repeats / elapsed.count();
+        };
+
+        size_t crossover = 0;
+        for (size_t n : {1, 4, 16, 64, 256, 1024, 4096}) {
+            const auto walk = rate([&](auto batch, auto labels) { forest.predict_batch(batch, labels); }, n);
+            const auto dense = rate([&](auto batch, auto labels) { gemm.predict_batch(batch, labels); }, n);
+
+            std::printf("batch %5zu: pointer chasing %10.0f rows/s, GEMM %10.0f rows/s\n", n, walk, dense);
+            if (dense > walk && crossover == 0) {
+                crossover = n;
+            }
+        }
+
+        if (crossover) {
+            std::printf("GEMM crossover at a batch of %zu rows\n", crossover);
+        } else {
+            std::printf("GEMM never overtakes pointer chasing up to 4096 rows\n");
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Shallow-subtree lookup tables", "[bench][baseline][lookup]") {
+    auto rows = to_rows(load_test_samples());
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+
+    if (!rows.empty()) {
+        std::vector<int> labels(rows.size());
+
+        forest.set_engine(Forest::Engine::Compact);
+        report_rows_per_second("compact walk (no table)", rows.size(), [&]() {
+            forest.predict_batch(rows, labels);
+            return sum_labels(labels);
+        });
+
+        forest.set_engine(Forest::Engine::Lookup);
+        for (size_t levels = 1; levels <= LookupForest::MAX_LEVELS; levels++) {
+            forest.set_lookup_levels(levels);
+            const auto table_bytes = LookupForest::from_forest(forest, levels).table_bytes();
+
+            char name[48];
+            std::snprintf(name, sizeof(name), "lookup k=%zu (%zu KB tables)%s", levels, table_bytes / 1024,
+                levels == LookupForest::DEFAULT_LEVELS ? " *" : "");
+            report_rows_per_second(name, rows.size(), [&]() {
+                forest.predict_batch(rows, labels);
+                return sum_labels(labels);
+            });
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Cache misses with a hot forest top", "[bench][baseline][forest][cache]") {
+    std::vector<std::string> paths;
+    if (std::filesystem::is_directory("data")) {
+        for (const auto& entry : std::filesystem::directory_iterator("data")) {
+            if (entry.path().filename().string().starts_with("Test_full")) {
+                paths.push_back(entry.path().string());
+            }
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+#ifdef __linux__
+    PerfCounter l1d(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+        | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    PerfCounter llc(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#else
+    PerfCounter l1d(0, 0);
+    PerfCounter llc(0, 0);
+#endif
+    const bool counters = l1d.valid() && llc.valid();
+    if (!counters) {
+        std::printf("perf counters unavailable here; reporting the cache model only\n");
+    }
+
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    std::printf("arena %zu KB\n", forest.arena_size() * sizeof(ForestNode) / 1024);
+
+    for (const auto& path : paths) {
+        auto rows = to_rows(load_test_samples(path));
+        if (rows.empty()) {
+            continue;
+        }
+
+        // Enough passes over small files for the counts to settle
+        const int repeats = std::max<int>(1, 200000 / rows.size());
+        std::printf("%s (%zu rows x %d)\n", path.c_str(), rows.size(), repeats);
+
+        for (size_t budget : {size_t(0), size_t(16 * 1024), Forest::HOT_TABLE_BUDGET, size_t(64 * 1024)}) {
+            forest.set_hot_table_budget(budget);
+
+            auto score = [&]() {
                 int sum = 0;
-                for (const auto& sample : samples) {
-                    auto svec = sample.to_array();
-                    sum += predictor.predict(svec);
+                for (const auto& features : rows) {
+                    sum += forest.predict(features);
                 }
                 return sum;
-            });
-        };
+            };
+            score();
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "  budget %2zu KB: %zu levels, %zu KB", budget / 1024,
+                forest.get_hot_levels(), forest.hot_table_bytes() / 1024);
+
+            if (counters) {
+                l1d.start();
+                llc.start();
+            }
+            report_rows_per_second(name, rows.size(), score, repeats);
+            if (counters) {
+                const double scored = static_cast<double>(rows.size()) * repeats;
+                const auto l1d_misses = l1d.stop();
+                const auto llc_misses = llc.stop();
+
+                std::printf("  %-38s %12.2f L1D misses/row %8.3f LLC misses/row\n", "",
+                    l1d_misses / scored, llc_misses / scored);
+            }
+
+            // Node loads of the same walks through a 32 KB 8-way and a 48 KB
+            // 12-way L1D, after one warm-up pass
+            CacheModel small(32 * 1024, 8);
+            CacheModel large(48 * 1024, 12);
+            for (int pass = 0; pass < 2; pass++) {
+                small.reset_counts();
+                large.reset_counts();
+
+                for (const auto& features : rows) {
+                    for (auto root : forest.get_roots()) {
+                        const ForestNode* node = forest.get_arena() + root;
+
+                        while (true) {
+                            small.load(node);
+                            large.load(node);
+                            if (node->feature == -1) {
+                                break;
+                            }
+
+                            node = forest.get_arena() + node->left + !(features[node->feature] <= node->bound);
+                        }
+                    }
+                }
+            }
+
+            std::printf("  %-38s %12.1f node loads/row, modelled L1D misses/row %.2f (32K/8w) %.2f (48K/12w)\n", "",
+                double(small.accesses) / rows.size(), double(small.misses) / rows.size(),
+                double(large.misses) / rows.size());
+        }
     }
 }
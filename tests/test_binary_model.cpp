@@ -0,0 +1,120 @@
+#include <catch.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "../include/BinaryModel.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("Binary model round-trips the embedded predictor", "[binary_model]") {
+    const char* path = "tests/fixtures/test_model_temp.ppm";
+    Predictor predictor = Predictor::LoadEmbedded();
+    write_binary_model(predictor, path);
+
+    {
+        MappedModel model = Predictor::LoadBinary(path);
+
+        REQUIRE(model.view().tree_count() == 120);
+        REQUIRE(model.view().node_count() == predictor.get_forest().arena_size());
+
+        for (const auto& features : random_features(predictor.get_forest(), 2000)) {
+            REQUIRE(model.predict(features) == predictor.predict(features));
+        }
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE("Binary model loads a converted JSON model", "[binary_model]") {
+    const char* path = "tests/fixtures/test_model_temp.ppm";
+    std::ifstream model_fin("tests/fixtures/test_model.json");
+    Predictor predictor = nlohmann::json::parse(model_fin).get<Predictor>();
+    write_binary_model(predictor, path);
+
+    {
+        MappedModel model = Predictor::LoadBinary(path);
+        REQUIRE(model.view().tree_count() == 2);
+
+        FeatureArray features = {};
+        features.fill(0.0);
+        REQUIRE(model.predict(features) == predictor.predict(features));
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE("Binary model rejects bad files", "[binary_model]") {
+    const char* path = "tests/fixtures/test_model_temp.ppm";
+
+    SECTION("Missing file") {
+        REQUIRE_THROWS_AS(Predictor::LoadBinary("tests/fixtures/does_not_exist.ppm"), std::runtime_error);
+    }
+
+    SECTION("Wrong magic") {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(256, 'x');
+        out.close();
+        REQUIRE_THROWS_AS(Predictor::LoadBinary(path), std::runtime_error);
+    }
+
+    SECTION("Truncated node array") {
+        write_binary_model(Predictor::LoadEmbedded(), path);
+        std::string bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), {});
+        }
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size() / 2);
+        out.close();
+        REQUIRE_THROWS_AS(Predictor::LoadBinary(path), std::runtime_error);
+    }
+
+    SECTION("Child index that wraps around") {
+        write_binary_model(Predictor::LoadEmbedded(), path);
+        std::string bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), {});
+        }
+
+        BinaryModelHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        auto* nodes = reinterpret_cast<ForestNode*>(bytes.data() + header.nodes_offset);
+
+        // left + 1 is 0 in 32 bits
+        auto* internal = std::find_if(nodes, nodes + header.n_nodes, [](const ForestNode& n) { return n.feature != -1; });
+        REQUIRE(internal != nodes + header.n_nodes);
+        internal->left = 0xFFFFFFFF;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size());
+        out.close();
+        REQUIRE_THROWS_AS(Predictor::LoadBinary(path), std::runtime_error);
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE("Binary model keeps the early-exit tree order", "[binary_model]") {
+    const char* path = "tests/fixtures/test_model_temp.ppm";
+    auto data = Predictor::EmbeddedJson();
+    Forest forest = data.get<Predictor>().get_forest();
+    forest.reorder_trees(random_features(forest, 1000));
+    REQUIRE_FALSE(forest.get_eval_order().empty());
+
+    data["model"]["eval_order"] = forest.get_eval_order();
+    Predictor predictor = data.get<Predictor>();
+    write_binary_model(predictor, path);
+
+    {
+        MappedModel model = Predictor::LoadBinary(path);
+
+        for (const auto& features : random_features(predictor.get_forest(), 2000, 3)) {
+            REQUIRE(model.predict(features) == predictor.predict(features));
+        }
+    }
+
+    std::remove(path);
+}
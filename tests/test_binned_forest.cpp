@@ -0,0 +1,59 @@
+#include <catch.hpp>
+#include <cmath>
+#include "../include/BinnedForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("BinnedForest matches Forest on the embedded model", "[binned]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    BinnedForest bf = BinnedForest::from_forest(forest);
+
+    const auto rows = random_features(forest, 2000);
+    std::vector<BinnedRow> binned;
+    for (const auto& features : rows) {
+        binned.push_back(bf.bin(features));
+    }
+
+    std::vector<int> labels(rows.size());
+    bf.predict_binned(binned, labels);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(labels[i] == forest.predict(rows[i]));
+    }
+
+    FeatureArray features = {};
+    features.fill(std::nan(""));
+    REQUIRE(bf.predict(features) == forest.predict(features));
+}
+
+TEST_CASE("BinnedForest ranks count the bounds a value goes right at", "[binned]") {
+    // Feature 0 splits at 5 in the single tree
+    Forest forest = create_single_tree_forest();
+    BinnedForest bf = BinnedForest::from_forest(forest);
+    const auto bound = forest.get_trees()[0].bound(0);
+
+    REQUIRE(bf.bin_count(0) == 1);
+
+    FeatureArray features = {};
+    features[0] = bound;
+    REQUIRE(bf.bin(features)[0] == 0);
+
+    features[0] = std::nextafter(bound, INFINITY);
+    REQUIRE(bf.bin(features)[0] == 1);
+
+    features[0] = -INFINITY;
+    REQUIRE(bf.bin(features)[0] == 0);
+
+    features[0] = std::nan("");
+    REQUIRE(bf.bin(features)[0] == 1);
+}
+
+TEST_CASE("BinnedForest batch entry points check spans", "[binned][batch]") {
+    BinnedForest bf = BinnedForest::from_forest(create_majority_vote_forest());
+    std::vector<FeatureArray> rows(3);
+    std::vector<BinnedRow> binned(3);
+    std::vector<int> out(2);
+
+    REQUIRE_THROWS_AS(bf.predict_batch(rows, out), std::invalid_argument);
+    REQUIRE_THROWS_AS(bf.predict_binned(binned, out), std::invalid_argument);
+}
@@ -0,0 +1,103 @@
+#include <catch.hpp>
+#include <cmath>
+#include <limits>
+#include "../include/BranchlessForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+using json = nlohmann::json;
+
+TEST_CASE("BranchlessForest pads shallow leaves to full depth", "[branchless]") {
+    json forest_json = {
+        {"n_estimators", 1},
+        {"n_features", 13},
+        {"n_classes", 2},
+        {"classes", {0, 1}},
+        {"trees", {{
+            // Root splits on feature[2]; its right child is a leaf at depth 1
+            {"feature", {2, 0, -2, -2, -2}},
+            {"threshold", {10.0, 50.0, 0.0, 0.0, 0.0}},
+            {"children_left", {1, 3, -1, -1, -1}},
+            {"children_right", {2, 4, -1, -1, -1}},
+            {"value", {{{0.0, 0.0}}, {{0.0, 0.0}}, {{5.0, 30.0}}, {{25.0, 5.0}}, {{15.0, 20.0}}}},
+            {"n_node_samples", {100, 60, 40, 30, 30}}
+        }}}
+    };
+    Forest forest = forest_json.get<Forest>();
+    BranchlessForest bf = BranchlessForest::from_forest(forest);
+
+    // Depth 2: three internal slots and four bottom slots
+    REQUIRE(bf.padded_node_count() == 7);
+
+    FeatureArray features = {};
+    features.fill(0.0);
+    for (double x : {0.0, 10.0, 10.0 + 5e-6, 10.0 + 2e-5, 20.0}) {
+        for (double y : {0.0, 50.0, 60.0}) {
+            features[2] = x;
+            features[0] = y;
+            REQUIRE(bf.predict(features) == forest.predict(features));
+        }
+    }
+
+    features[2] = std::numeric_limits<double>::quiet_NaN();
+    REQUIRE(bf.predict(features) == forest.predict(features));
+}
+
+TEST_CASE("BranchlessForest matches Forest on embedded model", "[branchless]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    BranchlessForest bf = BranchlessForest::from_forest(forest);
+
+    for (const auto& features : random_features(forest, 2000)) {
+        REQUIRE(bf.predict(features) == forest.predict(features));
+    }
+}
+
+// One tree of `depth` levels whose left children are all leaves
+static Forest create_chain_forest(int depth) {
+    std::vector<int> feature, left, right;
+    std::vector<double> threshold;
+    json value = json::array();
+
+    for (int i = 0; i < depth; i++) {
+        feature.push_back(0);
+        threshold.push_back(i);
+        left.push_back(depth + i);
+        right.push_back(i + 1 < depth ? i + 1 : 2 * depth);
+        value.push_back({{0.0, 0.0}});
+    }
+    for (int i = 0; i <= depth; i++) {
+        feature.push_back(-2);
+        threshold.push_back(0.0);
+        left.push_back(-1);
+        right.push_back(-1);
+        value.push_back({{double(i % 2), double(1 - i % 2)}});
+    }
+
+    json forest_json = {
+        {"n_estimators", 1},
+        {"n_features", 13},
+        {"n_classes", 2},
+        {"classes", {0, 1}},
+        {"trees", {{
+            {"feature", feature},
+            {"threshold", threshold},
+            {"children_left", left},
+            {"children_right", right},
+            {"value", value}
+        }}}
+    };
+    return forest_json.get<Forest>();
+}
+
+TEST_CASE("BranchlessForest rejects trees deeper than MAX_DEPTH", "[branchless]") {
+    Forest shallow = create_chain_forest(12);
+    BranchlessForest bf = BranchlessForest::from_forest(shallow);
+
+    for (const auto& features : random_features(shallow, 200)) {
+        REQUIRE(bf.predict(features) == shallow.predict(features));
+    }
+
+    REQUIRE_THROWS_AS(
+        BranchlessForest::from_forest(create_chain_forest(BranchlessForest::MAX_DEPTH + 1)), std::invalid_argument
+    );
+}
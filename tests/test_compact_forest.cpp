@@ -0,0 +1,24 @@
+#include <catch.hpp>
+#include <cmath>
+#include "../include/CompactForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("CompactForest matches Forest on the embedded model", "[compact]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    CompactForest cf = CompactForest::from_forest(forest);
+
+    size_t tree_nodes = 0;
+    for (const auto& tree : forest.get_trees()) {
+        tree_nodes += tree.node_count();
+    }
+    REQUIRE(cf.node_count() == tree_nodes);
+
+    for (const auto& features : random_features(forest, 2000)) {
+        REQUIRE(cf.predict(features) == forest.predict(features));
+    }
+
+    FeatureArray features = {};
+    features.fill(std::nan(""));
+    REQUIRE(cf.predict(features) == forest.predict(features));
+}
@@ -0,0 +1,104 @@
+#include <catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "../include/FloatForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+// The double whose float rounding FloatForest sees
+static FeatureArray through_float(const FeatureArray& features) {
+    FeatureArray out;
+    for (size_t f = 0; f < N_FEATURES; f++) {
+        out[f] = static_cast<float>(features[f]);
+    }
+    return out;
+}
+
+TEST_CASE("FloatForest::float_bound is the largest float not above the bound", "[float32]") {
+    for (double bound : std::vector<double>{0.0, 1.0, 0.1, -0.1, 1e-30, -3.5e38, 1e300, -1e300, INFINITY, -INFINITY}) {
+        const float f = FloatForest::float_bound(bound);
+
+        REQUIRE(static_cast<double>(f) <= bound);
+        if (f != INFINITY) {
+            REQUIRE(static_cast<double>(std::nextafterf(f, INFINITY)) > bound);
+        }
+    }
+}
+
+TEST_CASE("FloatForest matches Forest on float-representable inputs", "[float32]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    FloatForest ff = FloatForest::from_forest(forest);
+
+    size_t tree_nodes = 0;
+    for (const auto& tree : forest.get_trees()) {
+        tree_nodes += tree.node_count();
+    }
+    REQUIRE(ff.node_count() == tree_nodes);
+
+    for (const auto& features : random_features(forest, 2000)) {
+        REQUIRE(ff.predict(to_float(features)) == forest.predict(through_float(features)));
+    }
+
+    FeatureArray nan_row = {};
+    nan_row.fill(std::nan(""));
+    REQUIRE(ff.predict(to_float(nan_row)) == forest.predict(nan_row));
+}
+
+TEST_CASE("FloatForest reports thresholds no float can stand in for", "[float32]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    FloatForest ff = FloatForest::from_forest(forest);
+    const auto& rounding = ff.get_rounding();
+
+    REQUIRE(rounding.nodes == rounding.exact + rounding.inexact.size());
+
+    const auto& trees = forest.get_trees();
+    for (const auto& [tree, node] : rounding.inexact) {
+        // Either the bound itself rounds up past the float bound (left in
+        // double, right in float) or the next double rounds down onto it
+        const auto& compact = trees[tree].get_nodes()[node];
+        const auto f = FloatForest::float_bound(compact.bound);
+
+        REQUIRE((static_cast<float>(compact.bound) > f
+            || static_cast<float>(std::nextafter(compact.bound, INFINITY)) <= f));
+    }
+}
+
+TEST_CASE("FloatForest AVX2 batch matches single-sample scoring", "[float32][batch]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    FloatForest ff = FloatForest::from_forest(forest);
+
+    // Odd count so the last block of 8 is partial
+    std::vector<FeatureArrayF> rows;
+    for (const auto& features : random_features(forest, 1003, 9)) {
+        rows.push_back(to_float(features));
+    }
+    rows[4][2] = std::numeric_limits<float>::quiet_NaN();
+    rows[7][0] = std::numeric_limits<float>::infinity();
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(ff.predict(features));
+    }
+
+    std::vector<int> out(rows.size(), -1);
+    ff.predict_batch(rows, out);
+    REQUIRE(out == expected);
+
+    std::fill(out.begin(), out.end(), -1);
+    if (__builtin_cpu_supports("avx2")) {
+        ff.predict_batch_avx2(rows, out);
+        REQUIRE(out == expected);
+    } else {
+        REQUIRE_THROWS_AS(ff.predict_batch_avx2(rows, out), std::runtime_error);
+    }
+}
+
+TEST_CASE("FloatForest::predict_batch checks spans", "[float32][batch]") {
+    FloatForest ff = FloatForest::from_forest(create_majority_vote_forest());
+    std::vector<FeatureArrayF> rows(3);
+    std::vector<int> out(2);
+
+    REQUIRE_THROWS_AS(ff.predict_batch(rows, out), std::invalid_argument);
+    REQUIRE_THROWS_AS(ff.predict_batch_avx2(rows, out), std::invalid_argument);
+}
@@ -1,5 +1,8 @@
 #include <catch.hpp>
+#include <cmath>
 #include "../include/Forest.h"
+#include "../include/ModelView.h"
+#include "../include/Predictor.h"
 #include "test_helpers.hpp"
 
 TEST_CASE("Forest returns 0 when all trees vote for class 0", "[forest][voting]") {
@@ -95,3 +98,529 @@ TEST_CASE("Forest large feature values", "[forest][values]") {
 
     REQUIRE((prediction == 0 || prediction == 1));
 }
+
+TEST_CASE("Forest arena packs every tree node", "[forest][arena]") {
+    Forest forest = create_majority_vote_forest();
+
+    // Each tree: root, padding slot, one sibling pair
+    REQUIRE(forest.arena_size() == 3 * 4);
+}
+
+TEST_CASE("Forest arena matches per-tree traversal on embedded model", "[forest][arena]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+
+    for (const auto& features : random_features(forest, 2000)) {
+        REQUIRE(forest.predict(features) == reference_predict(forest, features));
+    }
+}
+
+TEST_CASE("Forest engines are selectable at runtime", "[forest][engine]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    auto rows = random_features(forest, 500);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    for (auto name : {"quickscorer", "branchless", "compact", "binned", "gather", "gemm", "lookup", "arena"}) {
+        forest.set_engine(Forest::engine_from_name(name));
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            REQUIRE(forest.predict(rows[i]) == expected[i]);
+        }
+    }
+
+    REQUIRE(forest.get_engine() == Forest::Engine::Arena);
+    REQUIRE_THROWS_AS(Forest::engine_from_name("bogus"), std::invalid_argument);
+}
+
+TEST_CASE("Folding the scaler leaves predictions unchanged", "[forest][fold]") {
+    auto data = Predictor::EmbeddedJson();
+    auto scaler = data.at("scaler").get<Scaler>();
+    auto scaled = data.at("model").get<Forest>();
+
+    Forest folded = scaled;
+    folded.fold_scaler(scaler);
+
+    for (const auto& features : random_features(folded, 5000)) {
+        auto transformed = features;
+        scaler.transform(transformed);
+
+        REQUIRE(folded.predict(features) == reference_predict(scaled, transformed));
+        REQUIRE(reference_predict(folded, features) == reference_predict(scaled, transformed));
+    }
+
+    REQUIRE_THROWS_AS(folded.fold_scaler(scaler), std::logic_error);
+}
+
+TEST_CASE("Folding a non-trivial scaler keeps the epsilon rule", "[forest][fold]") {
+    nlohmann::json scaler_json = {
+        {"scale", {0.25, 3.0, 1e-3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}},
+        {"mean", {1.5, -2.0, 40.0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
+    };
+    auto scaler = scaler_json.get<Scaler>();
+    Forest scaled = create_majority_vote_forest();
+    Forest folded = scaled;
+    folded.fold_scaler(scaler);
+
+    // Raw values whose scaled image lands on, or just around, each tree's threshold
+    const double thresholds[3] = {5.0, 10.0, 15.0};
+    for (double offset : {0.0, 5e-6, 9.9e-6, 1e-5, -1e-5, -1.0, 1.0}) {
+        for (size_t f = 0; f < 3; f++) {
+            FeatureArray features = {};
+            features[f] = (thresholds[f] + offset) * scaler.get_scale()[f] + scaler.get_mean()[f];
+
+            for (int step = -2; step <= 2; step++) {
+                auto raw = features;
+                for (int i = 0; i < std::abs(step); i++) {
+                    raw[f] = std::nextafter(raw[f], step < 0 ? -INFINITY : INFINITY);
+                }
+
+                auto transformed = raw;
+                scaler.transform(transformed);
+                REQUIRE(folded.predict(raw) == reference_predict(scaled, transformed));
+            }
+        }
+    }
+}
+
+TEST_CASE("Forest::predict_batch matches predict on every engine", "[forest][batch]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 1000);
+    const auto before = rows;
+
+    for (auto name : {"arena", "quickscorer", "branchless", "compact", "binned", "gather", "gemm", "lookup"}) {
+        forest.set_engine(Forest::engine_from_name(name));
+        std::vector<int> labels(rows.size(), -1);
+
+        forest.predict_batch(rows, labels);
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            REQUIRE(labels[i] == forest.predict(rows[i]));
+        }
+        REQUIRE(rows == before);
+    }
+}
+
+TEST_CASE("Every engine matches the reference vote on helper forests", "[forest][engine]") {
+    std::vector<Forest> forests = {
+        create_single_tree_forest(),
+        create_unanimous_class0_forest(),
+        create_unanimous_class1_forest(),
+        create_majority_vote_forest(),
+        create_tie_forest(),
+    };
+
+    for (auto& forest : forests) {
+        const auto rows = random_features(forest, 200);
+
+        for (auto name : {"arena", "quickscorer", "branchless", "compact", "binned", "gather", "gemm", "lookup"}) {
+            forest.set_engine(Forest::engine_from_name(name));
+            std::vector<int> labels(rows.size(), -1);
+
+            forest.predict_batch(rows, labels);
+
+            for (size_t i = 0; i < rows.size(); i++) {
+                REQUIRE(forest.predict(rows[i]) == reference_predict(forest, rows[i]));
+                REQUIRE(labels[i] == reference_predict(forest, rows[i]));
+            }
+        }
+    }
+}
+
+TEST_CASE("Forest::predict_batch handles empty and mismatched spans", "[forest][batch]") {
+    Forest forest = create_majority_vote_forest();
+    std::vector<FeatureArray> rows(3, FeatureArray{});
+    std::vector<int> labels(2);
+
+    forest.predict_batch(std::span<const FeatureArray>(), std::span<int>());
+    REQUIRE_THROWS_AS(forest.predict_batch(rows, labels), std::invalid_argument);
+}
+
+TEST_CASE("Forest tiled batch matches predict for any tile sizes", "[forest][batch][tiling]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 300);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    for (size_t trees : {1, 7, 16, 120, 500}) {
+        for (size_t samples : {1, 13, 64, 1000}) {
+            forest.set_tiling({trees, samples});
+            std::vector<int> labels(rows.size(), -1);
+
+            forest.predict_batch(rows, labels);
+            REQUIRE(labels == expected);
+        }
+    }
+
+    REQUIRE_THROWS_AS(forest.set_tiling({0, 256}), std::invalid_argument);
+    REQUIRE_THROWS_AS(forest.set_tiling({16, 0}), std::invalid_argument);
+}
+
+TEST_CASE("Vote swing tables bound the remaining trees", "[forest][early_exit]") {
+    Forest forest = create_majority_vote_forest();
+    std::vector<double> rest_min;
+    std::vector<double> rest_max;
+
+    compute_vote_swing(forest.get_arena(), forest.get_roots().data(), 3, rest_min, rest_max);
+
+    // yes - no per tree: [-25, 75], [-40, 80], [60, 90]
+    REQUIRE(rest_min == std::vector<double>{-5.0, 20.0, 60.0, 0.0});
+    REQUIRE(rest_max == std::vector<double>{245.0, 170.0, 90.0, 0.0});
+}
+
+TEST_CASE("Forest early exit never changes a label", "[forest][early_exit]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 3000);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    forest.set_early_exit(true);
+    REQUIRE(forest.get_early_exit());
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(forest.predict(rows[i]) == expected[i]);
+    }
+
+    for (size_t trees : {1, 16, 120}) {
+        forest.set_tiling({trees, 64});
+        std::vector<int> labels(rows.size(), -1);
+
+        forest.predict_batch(rows, labels);
+        REQUIRE(labels == expected);
+    }
+}
+
+TEST_CASE("Tree reordering never changes a label", "[forest][early_exit][reorder]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 3000, 7);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    Forest reordered = forest;
+    auto report = reordered.reorder_trees(random_features(forest, 2000));
+    reordered.set_early_exit(true);
+
+    REQUIRE(report.mean_trees_after <= report.mean_trees_before);
+    REQUIRE(report.mean_trees_before == Approx(forest.mean_trees_evaluated(random_features(forest, 2000))));
+    REQUIRE(reordered.get_expected_trees() == report.mean_trees_after);
+
+    std::vector<int> labels(rows.size());
+    reordered.predict_batch(rows, labels);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(reordered.predict(rows[i]) == expected[i]);
+        REQUIRE(labels[i] == expected[i]);
+    }
+
+    // The order survives a JSON round trip
+    nlohmann::json j = reordered;
+    REQUIRE(j.get<Forest>().get_eval_order() == reordered.get_eval_order());
+}
+
+TEST_CASE("Reordered forests fall back to tree order on near ties", "[forest][early_exit][reorder]") {
+    auto leaf_tree = [](double no, double yes) {
+        return nlohmann::json{
+            {"feature", {-2}},
+            {"threshold", {0.0}},
+            {"children_left", {-1}},
+            {"children_right", {-1}},
+            {"value", {{{no, yes}}}},
+            {"n_node_samples", {1}}
+        };
+    };
+
+    // In tree order yes sums to 0.6000000000000001 and ties the no vote;
+    // visited backwards it sums to 0.6 and would lose
+    nlohmann::json forest_json = {
+        {"n_estimators", 4},
+        {"n_features", 13},
+        {"n_classes", 2},
+        {"classes", {0, 1}},
+        {"trees", {leaf_tree(0.0, 0.1), leaf_tree(0.0, 0.2), leaf_tree(0.0, 0.3), leaf_tree(0.6000000000000001, 0.0)}},
+        {"eval_order", {3, 2, 1, 0}}
+    };
+    Forest forest = forest_json.get<Forest>();
+    forest.set_early_exit(true);
+
+    FeatureArray features = {};
+    REQUIRE(forest.predict(features) == 1);
+    REQUIRE(reference_predict(forest, features) == 1);
+
+    forest_json["eval_order"] = {0, 1, 1, 3};
+    REQUIRE_THROWS_AS(forest_json.get<Forest>(), std::invalid_argument);
+}
+
+TEST_CASE("Forest::predict_within returns the forest label given time", "[forest][anytime]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+
+    for (const auto& features : random_features(forest, 1000)) {
+        auto vote = forest.predict_within(features, std::chrono::seconds(10));
+
+        REQUIRE(vote.decided);
+        REQUIRE(vote.label == forest.predict(features));
+        REQUIRE(vote.trees_used >= 1);
+        REQUIRE(vote.trees_used <= forest.get_trees().size());
+    }
+}
+
+TEST_CASE("Forest::predict_within degrades to a partial vote", "[forest][anytime]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+
+    for (const auto& features : random_features(forest, 200)) {
+        auto vote = forest.predict_within(features, std::chrono::nanoseconds(0));
+        const auto* leaf = arena_leaf(forest.get_arena(), forest.get_roots()[0], features);
+
+        // Out of time after the first tree unless that alone settles the vote
+        REQUIRE(vote.trees_used == 1);
+        REQUIRE(vote.margin == leaf->votes[1] - leaf->votes[0]);
+        REQUIRE(vote.label == forest.get_classes()[vote.margin >= 0 ? 1 : 0]);
+    }
+
+    // A timed-out vote stops only where the clock is read
+    for (const auto& features : random_features(forest, 200, 3)) {
+        for (int budget : {100, 500, 2000}) {
+            auto vote = forest.predict_within(features, std::chrono::nanoseconds(budget));
+
+            if (!vote.decided) {
+                REQUIRE((vote.trees_used - 1) % Forest::DEADLINE_STRIDE == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("Calibrated cascade matches the forest on its calibration set", "[forest][cascade]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 2000);
+
+    std::vector<int> expected(rows.size());
+    forest.predict_batch(rows, expected);
+
+    for (size_t k : {1, 10, 60, 120}) {
+        auto config = forest.calibrate_cascade(rows, k);
+        REQUIRE(config.prefix_trees == k);
+
+        forest.set_cascade(config);
+
+        std::vector<int> labels(rows.size());
+        forest.predict_batch(rows, labels);
+        REQUIRE(labels == expected);
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            REQUIRE(forest.predict(rows[i]) == expected[i]);
+        }
+
+        auto stats = forest.cascade_stats(rows);
+        REQUIRE(stats.rows == rows.size());
+        REQUIRE(stats.passed <= stats.rows);
+        REQUIRE(stats.mean_trees >= static_cast<double>(k));
+        REQUIRE(stats.mean_trees <= static_cast<double>(forest.get_trees().size()));
+    }
+
+    forest.set_cascade({});
+    REQUIRE(forest.cascade_stats(rows).passed == 0);
+}
+
+TEST_CASE("Cascade prefix must fit the forest", "[forest][cascade]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 10);
+    const auto n_trees = forest.get_trees().size();
+
+    REQUIRE_THROWS_AS(forest.calibrate_cascade(rows, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(forest.calibrate_cascade(rows, n_trees + 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(forest.set_cascade({n_trees + 1, 0.0, 0.0}), std::invalid_argument);
+}
+
+TEST_CASE("Forest::optimise keeps every label with any set of passes", "[forest][optimise]") {
+    const auto data = Predictor::EmbeddedJson();
+    const auto scaler = data.at("scaler").get<Scaler>();
+
+    Forest reference = data.at("model").get<Forest>();
+    reference.fold_scaler(scaler);
+
+    const auto rows = random_features(reference, 2000);
+    std::vector<int> expected(rows.size());
+    reference.predict_batch(rows, expected);
+
+    for (int mask = 0; mask < 64; mask++) {
+        OptimiseOptions options{
+            bool(mask & 1), bool(mask & 2), bool(mask & 4), bool(mask & 8), bool(mask & 16), bool(mask & 32)
+        };
+
+        Forest forest = reference;
+        auto report = forest.optimise(options);
+
+        REQUIRE(report.nodes_after == report.nodes_before - 2 * (report.dead_removed + report.collapsed));
+        REQUIRE(forest.get_leaf_margins() == options.leaf_margins);
+
+        std::vector<int> labels(rows.size());
+        forest.predict_batch(rows, labels);
+        REQUIRE(labels == expected);
+
+        for (size_t i = 0; i < rows.size(); i += 7) {
+            REQUIRE(forest.predict(rows[i]) == expected[i]);
+        }
+    }
+}
+
+TEST_CASE("Leaf margins fall back to the class sums on near ties", "[forest][optimise]") {
+    Forest forest = create_tie_forest();
+    forest.optimise();
+
+    for (const auto& features : random_features(forest, 200)) {
+        REQUIRE(forest.predict(features) == predict_arena(
+            forest.get_arena(), forest.get_roots().data(), forest.get_roots().size(),
+            forest.get_classes().data(), features
+        ));
+    }
+}
+
+TEST_CASE("Shared subtrees turn the arena into a valid DAG", "[forest][optimise][dag]") {
+    const auto data = Predictor::EmbeddedJson();
+    const auto scaler = data.at("scaler").get<Scaler>();
+
+    Forest reference = data.at("model").get<Forest>();
+    reference.fold_scaler(scaler);
+
+    Forest forest = reference;
+    auto report = forest.optimise();
+
+    REQUIRE(forest.get_shared_arena());
+    REQUIRE(report.arena_after < report.arena_before);
+    REQUIRE(forest.arena_size() == report.arena_after);
+
+    const ModelView view(
+        forest.get_arena(), forest.arena_size(), forest.get_roots().data(), forest.get_roots().size(),
+        forest.get_classes().data()
+    );
+    REQUIRE(view.is_valid());
+
+    for (const auto& features : random_features(reference, 2000)) {
+        REQUIRE(view.predict(features) == reference.predict(features));
+        REQUIRE(forest.predict(features) == reference.predict(features));
+    }
+}
+
+TEST_CASE("Identical trees share one root", "[forest][optimise][dag]") {
+    // Both trees collapse to the same single leaf
+    Forest forest = create_tie_forest();
+    forest.optimise();
+
+    REQUIRE(forest.arena_size() == 2);
+    REQUIRE(forest.get_roots() == std::vector<uint32_t>{0, 0});
+}
+
+TEST_CASE("Interleaved traversal gives the sequential labels", "[forest][interleave]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 1000);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    for (size_t group : {1, 2, 7, 8, 16}) {
+        forest.set_interleave(group);
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            REQUIRE(forest.predict(rows[i]) == expected[i]);
+        }
+    }
+
+    REQUIRE_THROWS_AS(forest.set_interleave(MAX_INTERLEAVE + 1), std::invalid_argument);
+}
+
+TEST_CASE("Group-prefetch batch matches predict for any group size", "[forest][batch][amac]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 1000);
+
+    std::vector<int> expected(rows.size());
+    forest.predict_batch(rows, expected);
+
+    for (size_t group : {1, 3, 8, 32, 2000}) {
+        forest.set_prefetch_group(group);
+
+        for (size_t n : {size_t(0), size_t(5), rows.size()}) {
+            std::vector<int> labels(n, -1);
+            forest.predict_batch(std::span<const FeatureArray>(rows.data(), n), labels);
+
+            for (size_t i = 0; i < n; i++) {
+                REQUIRE(labels[i] == expected[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("The hot table packs whole levels within its byte budget", "[forest][hot]") {
+    const auto data = Predictor::EmbeddedJson();
+    Forest tree_order = data.at("model").get<Forest>();
+    tree_order.fold_scaler(data.at("scaler").get<Scaler>());
+    Forest shared = tree_order;
+    shared.optimise();
+
+    for (Forest* forest : {&tree_order, &shared}) {
+        const auto rows = random_features(*forest, 1000);
+
+        std::vector<int> expected;
+        for (const auto& features : rows) {
+            expected.push_back(forest->predict(features));
+        }
+
+        REQUIRE(forest->hot_table_bytes() == 0);
+
+        size_t previous = 0;
+        for (size_t budget : {size_t(1024), size_t(8 * 1024), size_t(16 * 1024), Forest::HOT_TABLE_BUDGET,
+                size_t(64 * 1024), size_t(1) << 30}) {
+            forest->set_hot_table_budget(budget);
+
+            const auto hot_slots = forest->hot_table_bytes() / sizeof(ForestNode);
+            REQUIRE(forest->hot_table_bytes() <= budget);
+            REQUIRE(forest->get_hot_levels() >= previous);
+            REQUIRE(hot_slots <= forest->arena_size());
+            REQUIRE((forest->get_hot_levels() == 0) == (forest->hot_table_bytes() == 0));
+            previous = forest->get_hot_levels();
+
+            if (forest->get_hot_levels() > 0) {
+                for (auto root : forest->get_roots()) {
+                    REQUIRE(root < hot_slots);
+                }
+            }
+
+            const ModelView view(
+                forest->get_arena(), forest->arena_size(), forest->get_roots().data(), forest->get_roots().size(),
+                forest->get_classes().data()
+            );
+            REQUIRE(view.is_valid());
+
+            for (size_t i = 0; i < rows.size(); i++) {
+                REQUIRE(forest->predict(rows[i]) == expected[i]);
+            }
+        }
+
+        // An unlimited budget takes the whole arena
+        REQUIRE(forest->hot_table_bytes() == forest->arena_size() * sizeof(ForestNode));
+
+        forest->set_hot_table_budget(0);
+        REQUIRE(forest->hot_table_bytes() == 0);
+        REQUIRE(forest->get_hot_levels() == 0);
+    }
+
+    // One root unit per tree is the smallest block; a byte less packs nothing
+    const auto roots_only = tree_order.get_trees().size() * 2 * sizeof(ForestNode);
+    tree_order.set_hot_table_budget(roots_only);
+    REQUIRE(tree_order.get_hot_levels() == 1);
+    REQUIRE(tree_order.hot_table_bytes() == roots_only);
+
+    tree_order.set_hot_table_budget(roots_only - 1);
+    REQUIRE(tree_order.get_hot_levels() == 0);
+}
@@ -0,0 +1,33 @@
+#include <catch.hpp>
+#include <cmath>
+#include "../include/GatherForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("GatherForest batches of any size match Forest on the embedded model", "[gather]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    GatherForest gf = GatherForest::from_forest(forest);
+
+    auto rows = random_features(forest, 2003);
+    rows[5].fill(std::nan(""));
+    rows[6][3] = std::nan("");
+
+    for (size_t n : {size_t(1), size_t(3), size_t(4), size_t(7), rows.size()}) {
+        std::span<const FeatureArray> batch(rows.data(), n);
+        std::vector<int> labels(n, -1);
+
+        gf.predict_batch(batch, labels);
+
+        for (size_t i = 0; i < n; i++) {
+            REQUIRE(labels[i] == forest.predict(rows[i]));
+        }
+    }
+}
+
+TEST_CASE("GatherForest::predict_batch checks spans", "[gather][batch]") {
+    GatherForest gf = GatherForest::from_forest(create_majority_vote_forest());
+    std::vector<FeatureArray> rows(3);
+    std::vector<int> out(2);
+
+    REQUIRE_THROWS_AS(gf.predict_batch(rows, out), std::invalid_argument);
+}
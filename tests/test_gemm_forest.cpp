@@ -0,0 +1,31 @@
+#include <catch.hpp>
+#include <cmath>
+#include "../include/GemmForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("GemmForest matches Forest on the embedded model", "[gemm]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    GemmForest gf = GemmForest::from_forest(forest);
+
+    // Non-finite rows are mixed into the blocks
+    auto rows = random_features(forest, 1000);
+    rows[3].fill(std::nan(""));
+    rows[70][2] = INFINITY;
+    rows[71][0] = -INFINITY;
+
+    std::vector<int> labels(rows.size(), -1);
+    gf.predict_batch(rows, labels);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(labels[i] == forest.predict(rows[i]));
+    }
+}
+
+TEST_CASE("GemmForest::predict_batch checks spans", "[gemm][batch]") {
+    GemmForest gf = GemmForest::from_forest(create_majority_vote_forest());
+    std::vector<FeatureArray> rows(3);
+    std::vector<int> out(2);
+
+    REQUIRE_THROWS_AS(gf.predict_batch(rows, out), std::invalid_argument);
+}
@@ -1,5 +1,8 @@
 #include "test_helpers.hpp"
 #include <json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
 
 using json = nlohmann::json;
 using namespace std;
@@ -239,3 +242,59 @@ Scaler create_zero_mean_scaler() {
     };
     return scaler_json.get<Scaler>();
 }
+
+int reference_predict(const Forest& forest, const FeatureArray& features) {
+    double no_votes = 0.0;
+    double yes_votes = 0.0;
+
+    for (const auto& tree : forest.get_trees()) {
+        auto vote = tree.predict(features);
+        no_votes += std::get<0>(vote);
+        yes_votes += std::get<1>(vote);
+    }
+
+    return yes_votes >= no_votes ? forest.get_classes()[1] : forest.get_classes()[0];
+}
+
+std::vector<FeatureArray> random_features(const Forest& forest, size_t n, unsigned seed) {
+    std::vector<std::vector<double>> thresholds(N_FEATURES);
+    for (const auto& tree : forest.get_trees()) {
+        for (size_t node = 0; node < tree.node_count(); node++) {
+            if (tree.get_children_left()[node] != -1) {
+                thresholds[tree.get_feature()[node]].push_back(tree.get_threshold()[node]);
+            }
+        }
+    }
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<FeatureArray> rows(n);
+    for (auto& row : rows) {
+        for (size_t f = 0; f < N_FEATURES; f++) {
+            if (thresholds[f].empty()) {
+                row[f] = normal(rng);
+                continue;
+            }
+
+            // Spread values over the feature's threshold range so that rows
+            // exercise the trees whether the forest is scaled or folded
+            auto [lo, hi] = std::minmax_element(thresholds[f].begin(), thresholds[f].end());
+            auto t = thresholds[f][rng() % thresholds[f].size()];
+            auto spread = *hi > *lo ? (*hi - *lo) / 4 : std::max(std::abs(t), 1.0);
+
+            if (uniform(rng) < 0.1) {
+                const double offsets[] = {
+                    0.0, std::nextafter(t, INFINITY) - t, std::nextafter(t, -INFINITY) - t,
+                    5e-6, -5e-6, 1e-5, 2e-5
+                };
+                row[f] = t + offsets[rng() % 7];
+            } else {
+                row[f] = t + normal(rng) * spread;
+            }
+        }
+    }
+
+    return rows;
+}
@@ -22,3 +22,12 @@ Forest create_tie_forest();
 
 Scaler create_test_scaler();
 Scaler create_zero_mean_scaler();
+
+// Reference answer: Tree::predict summed over the trees in order, the way
+// Forest::predict originally voted
+int reference_predict(const Forest& forest, const FeatureArray& features);
+
+// Feature rows for engine equivalence tests, spread over each feature's
+// threshold range. About a tenth of the values land on, one ulp beside, or
+// within epsilon of one of the forest's thresholds.
+std::vector<FeatureArray> random_features(const Forest& forest, size_t n, unsigned seed = 42);
@@ -0,0 +1,66 @@
+#include <catch.hpp>
+#include <cmath>
+#include "../include/LookupForest.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("LookupForest tables deeper than the trees fill in the missing levels", "[lookup]") {
+    // One split, so every k above 1 pads the table
+    Forest forest = create_single_tree_forest();
+
+    for (size_t levels = 1; levels <= LookupForest::MAX_LEVELS; levels++) {
+        LookupForest lf = LookupForest::from_forest(forest, levels);
+
+        for (const auto& features : random_features(forest, 100)) {
+            REQUIRE(lf.predict(features) == forest.predict(features));
+        }
+    }
+}
+
+TEST_CASE("LookupForest matches Forest on the embedded model for every k", "[lookup]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    auto rows = random_features(forest, 1000);
+    rows[0].fill(std::nan(""));
+
+    for (size_t levels = 1; levels <= LookupForest::MAX_LEVELS; levels++) {
+        LookupForest lf = LookupForest::from_forest(forest, levels);
+        REQUIRE(lf.get_levels() == levels);
+
+        for (const auto& features : rows) {
+            REQUIRE(lf.predict(features) == forest.predict(features));
+        }
+    }
+}
+
+TEST_CASE("LookupForest rejects table depths it cannot index", "[lookup]") {
+    Forest forest = create_single_tree_forest();
+
+    REQUIRE_THROWS_AS(LookupForest::from_forest(forest, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(LookupForest::from_forest(forest, LookupForest::MAX_LEVELS + 1), std::invalid_argument);
+}
+
+TEST_CASE("Forest passes the lookup depth to the engine", "[lookup][forest]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    const auto rows = random_features(forest, 300);
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(forest.predict(features));
+    }
+
+    REQUIRE(forest.get_lookup_levels() == LookupForest::DEFAULT_LEVELS);
+    forest.set_engine(Forest::Engine::Lookup);
+
+    for (size_t levels = 1; levels <= LookupForest::MAX_LEVELS; levels++) {
+        forest.set_lookup_levels(levels);
+        REQUIRE(forest.get_lookup_levels() == levels);
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            REQUIRE(forest.predict(rows[i]) == expected[i]);
+        }
+    }
+
+    REQUIRE_THROWS_AS(forest.set_lookup_levels(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(forest.set_lookup_levels(LookupForest::MAX_LEVELS + 1), std::invalid_argument);
+    REQUIRE(forest.get_lookup_levels() == LookupForest::MAX_LEVELS);
+}
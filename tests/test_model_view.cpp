@@ -0,0 +1,52 @@
+#include <catch.hpp>
+#include "../include/ModelView.h"
+#include "../include/Predictor.h"
+#include "../include/model_tables.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("Embedded model tables match the embedded JSON model", "[model_view]") {
+    Predictor predictor = Predictor::LoadEmbedded();
+    const Forest& forest = predictor.get_forest();
+
+    REQUIRE(embedded_model.tree_count() == forest.get_roots().size());
+    REQUIRE(embedded_model.node_count() == forest.arena_size());
+
+    for (size_t i = 0; i < forest.arena_size(); i++) {
+        REQUIRE(model_tables::nodes[i].bound == forest.get_arena()[i].bound);
+        REQUIRE(model_tables::nodes[i].feature == forest.get_arena()[i].feature);
+        REQUIRE(model_tables::nodes[i].left == forest.get_arena()[i].left);
+        REQUIRE(model_tables::nodes[i].votes[0] == forest.get_arena()[i].votes[0]);
+        REQUIRE(model_tables::nodes[i].votes[1] == forest.get_arena()[i].votes[1]);
+    }
+}
+
+TEST_CASE("constinit model predicts like Predictor", "[model_view]") {
+    Predictor predictor = Predictor::LoadEmbedded();
+
+    for (const auto& features : random_features(predictor.get_forest(), 2000)) {
+        REQUIRE(embedded_model.predict(features) == predictor.predict(features));
+    }
+}
+
+TEST_CASE("ModelView rejects out-of-range child indices", "[model_view]") {
+    const int classes[2] = {0, 1};
+    const uint32_t roots[1] = {0};
+
+    const ForestNode good[4] = {{5.0, 0, 2, {0, 0}}, {0.0, -1, 0, {0, 0}}, {0.0, -1, 0, {1, 0}}, {0.0, -1, 0, {0, 1}}};
+    const ForestNode bad[4] = {{5.0, 0, 3, {0, 0}}, {0.0, -1, 0, {0, 0}}, {0.0, -1, 0, {1, 0}}, {0.0, -1, 0, {0, 1}}};
+
+    REQUIRE(ModelView(good, 4, roots, 1, classes).is_valid());
+    REQUIRE_FALSE(ModelView(bad, 4, roots, 1, classes).is_valid());
+}
+
+TEST_CASE("constinit model batch matches Predictor batch", "[model_view][batch]") {
+    Predictor predictor = Predictor::LoadEmbedded();
+    auto rows = random_features(predictor.get_forest(), 1000);
+    std::vector<int> expected(rows.size());
+    std::vector<int> labels(rows.size());
+
+    predictor.predict_batch(rows, expected);
+    embedded_model.predict_batch(rows, labels);
+
+    REQUIRE(labels == expected);
+}
@@ -0,0 +1,91 @@
+#include <catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "../include/QuickScorer.h"
+#include "../include/Predictor.h"
+#include "test_helpers.hpp"
+
+TEST_CASE("QuickScorer applies epsilon tolerance like Tree::predict", "[quickscorer][epsilon]") {
+    Forest forest = create_single_tree_forest();
+    QuickScorer qs = QuickScorer::from_forest(forest);
+
+    FeatureArray features = {};
+    features.fill(0.0);
+
+    for (double x : {5.0, 5.0 + 5e-6, 5.0 + 2e-5, Tree::left_bound(5.0)}) {
+        features[0] = x;
+        REQUIRE(qs.predict(features) == forest.predict(features));
+    }
+
+    features[0] = std::numeric_limits<double>::quiet_NaN();
+    REQUIRE(qs.predict(features) == forest.predict(features));
+}
+
+TEST_CASE("QuickScorer matches Forest on embedded model", "[quickscorer]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    QuickScorer qs = QuickScorer::from_forest(forest);
+
+    REQUIRE(qs.tree_count() == 120);
+
+    for (const auto& features : random_features(forest, 2000)) {
+        REQUIRE(qs.predict(features) == forest.predict(features));
+    }
+}
+
+TEST_CASE("QuickScorer batch matches single-sample scoring", "[quickscorer][batch]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    QuickScorer qs = QuickScorer::from_forest(forest);
+
+    // Odd count so the last SIMD block is partial
+    auto rows = random_features(forest, 2003, 7);
+    rows[5][3] = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<int> out(rows.size(), -1);
+    qs.predict_batch(rows, out);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        REQUIRE(out[i] == forest.predict(rows[i]));
+    }
+}
+
+TEST_CASE("Each QuickScorer SIMD kernel matches single-sample scoring", "[quickscorer][batch]") {
+    Forest forest = Predictor::LoadEmbedded().get_forest();
+    QuickScorer qs = QuickScorer::from_forest(forest);
+
+    auto rows = random_features(forest, 1003, 11);
+    rows[2][0] = std::numeric_limits<double>::quiet_NaN();
+    rows[9][4] = std::numeric_limits<double>::infinity();
+
+    std::vector<int> expected;
+    for (const auto& features : rows) {
+        expected.push_back(qs.predict(features));
+    }
+
+    std::vector<int> out(rows.size(), -1);
+
+    if (__builtin_cpu_supports("avx2")) {
+        qs.predict_batch_avx2(rows, out);
+        REQUIRE(out == expected);
+    } else {
+        REQUIRE_THROWS_AS(qs.predict_batch_avx2(rows, out), std::runtime_error);
+    }
+
+    std::fill(out.begin(), out.end(), -1);
+    if (__builtin_cpu_supports("avx512f")) {
+        qs.predict_batch_avx512(rows, out);
+        REQUIRE(out == expected);
+    } else {
+        REQUIRE_THROWS_AS(qs.predict_batch_avx512(rows, out), std::runtime_error);
+    }
+}
+
+TEST_CASE("QuickScorer batch rejects mismatched output size", "[quickscorer][batch]") {
+    QuickScorer qs = QuickScorer::from_forest(create_single_tree_forest());
+    std::vector<FeatureArray> rows(3);
+    std::vector<int> out(2);
+
+    REQUIRE_THROWS_AS(qs.predict_batch(rows, out), std::invalid_argument);
+    REQUIRE_THROWS_AS(qs.predict_batch_avx2(rows, out), std::invalid_argument);
+    REQUIRE_THROWS_AS(qs.predict_batch_avx512(rows, out), std::invalid_argument);
+}
@@ -1,5 +1,6 @@
 #include <catch.hpp>
 #include <json.hpp>
+#include <cmath>
 #include "../include/Scaler.h"
 
 using json = nlohmann::json;
@@ -129,3 +130,27 @@ TEST_CASE("Scaler handles mixed positive and negative transformed values", "[sca
     REQUIRE(data[2] == Approx(0.0));
     REQUIRE(data[3] == Approx(1.0));
 }
+
+TEST_CASE("Scaler::raw_bound matches the scaled comparison", "[scaler][fold]") {
+    std::vector<double> mean = {0.1, -3.7, 1e4, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    std::vector<double> scale = {0.3, 7.9, 1e-3, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+    Scaler scaler = create_scaler_with_values(mean, scale);
+
+    for (size_t f = 0; f < 3; f++) {
+        for (double bound : {-2.5, -0.1, 0.0, 0.7, 1.3333333333333333}) {
+            double raw = scaler.raw_bound(f, bound);
+
+            REQUIRE((raw - mean[f]) / scale[f] <= bound);
+            REQUIRE_FALSE((std::nextafter(raw, INFINITY) - mean[f]) / scale[f] <= bound);
+        }
+    }
+}
+
+TEST_CASE("Scaler::raw_bound rejects non-positive scales", "[scaler][fold]") {
+    std::vector<double> mean(13, 0.0);
+    std::vector<double> scale(13, 1.0);
+    scale[4] = 0.0;
+    Scaler scaler = create_scaler_with_values(mean, scale);
+
+    REQUIRE_THROWS_AS(scaler.raw_bound(4, 1.0), std::invalid_argument);
+}
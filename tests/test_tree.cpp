@@ -142,3 +142,90 @@ TEST_CASE("Tree returns tuple with both classes", "[tree][structure]") {
     REQUIRE(class0_votes >= 0.0);
     REQUIRE(class1_votes >= 0.0);
 }
+
+TEST_CASE("Tree::left_bound folds the epsilon rule into the threshold", "[tree][epsilon]") {
+    Tree tree = create_simple_tree();
+    const double bound = Tree::left_bound(5.0);
+
+    FeatureArray at_bound = {bound, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    FeatureArray past_bound = at_bound;
+    past_bound[0] = std::nextafter(bound, INFINITY);
+
+    REQUIRE(bound > 5.0);
+    REQUIRE(std::get<0>(tree.predict(at_bound)) == Approx(10.0));    // Left branch
+    REQUIRE(std::get<0>(tree.predict(past_bound)) == Approx(2.0));   // Right branch
+}
+
+TEST_CASE("Tree::left_bound keeps large thresholds exact", "[tree][epsilon]") {
+    // The spacing of doubles near 1e12 exceeds the epsilon
+    REQUIRE(Tree::left_bound(1e12) == 1e12);
+}
+
+TEST_CASE("Tree compact encoding is preorder with implicit left children", "[tree][compact]") {
+    Tree tree = create_multilevel_tree();
+    const auto& nodes = tree.get_nodes();
+    const auto& votes = tree.get_leaf_votes();
+
+    // Original nodes 0, 1, 3, 4, 2 in preorder
+    REQUIRE(nodes.size() == 5);
+    REQUIRE(nodes[0].feature == 2);
+    REQUIRE(nodes[0].payload == 4);
+    REQUIRE(nodes[1].feature == 0);
+    REQUIRE(nodes[1].payload == 2);
+    REQUIRE(nodes[0].bound == Tree::left_bound(10.0));
+
+    for (size_t i = 2; i < 5; i++) {
+        REQUIRE(nodes[i].feature == COMPACT_LEAF);
+        REQUIRE(nodes[i].payload == i - 2);
+    }
+
+    REQUIRE(votes[0] == std::array<double, 2>{25.0, 5.0});
+    REQUIRE(votes[1] == std::array<double, 2>{15.0, 20.0});
+    REQUIRE(votes[2] == std::array<double, 2>{5.0, 30.0});
+}
+
+TEST_CASE("Tree::simplify removes dead tests and identical subtrees", "[tree][optimise]") {
+    // Node 1 repeats its parent's test more loosely and always goes left;
+    // node 4 has the same leaf on both sides
+    nlohmann::json j = {
+        {"feature", {0, 0, -2, -2, 1, -2, -2}},
+        {"threshold", {5.0, 8.0, -2.0, -2.0, 3.0, -2.0, -2.0}},
+        {"children_left", {1, 2, -1, -1, 5, -1, -1}},
+        {"children_right", {4, 3, -1, -1, 6, -1, -1}},
+        {"value", {{{0, 0}}, {{0, 0}}, {{1, 0}}, {{0, 1}}, {{0, 0}}, {{2, 2}}, {{2, 2}}}},
+        {"n_node_samples", {7, 6, 5, 4, 3, 2, 1}}
+    };
+    const Tree original = j.get<Tree>();
+    Tree tree = original;
+
+    auto stats = tree.simplify(true, true);
+
+    REQUIRE(stats.dead == 1);
+    REQUIRE(stats.collapsed == 1);
+    REQUIRE(tree.node_count() == 3);
+    REQUIRE(tree.get_children_left() == std::vector<int>{1, -1, -1});
+    REQUIRE(tree.get_children_right() == std::vector<int>{2, -1, -1});
+
+    for (double x : std::vector<double>{-1.0, 5.0, 5.0 + 5e-6, 5.0 + 2e-5, 8.0, 9.0, NAN, INFINITY, -INFINITY}) {
+        FeatureArray features{};
+        features[0] = x;
+        features[1] = x;
+        REQUIRE(tree.predict(features) == original.predict(features));
+    }
+
+    tree.drop_node_samples();
+    nlohmann::json out = tree;
+    REQUIRE_FALSE(out.contains("n_node_samples"));
+    REQUIRE(out.get<Tree>().node_count() == 3);
+}
+
+TEST_CASE("Tree::simplify passes can be switched off", "[tree][optimise]") {
+    Tree tree = create_multilevel_tree();
+    const auto nodes = tree.node_count();
+
+    auto stats = tree.simplify(false, false);
+
+    REQUIRE(stats.dead == 0);
+    REQUIRE(stats.collapsed == 0);
+    REQUIRE(tree.node_count() == nodes);
+}
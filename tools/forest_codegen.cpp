@@ -0,0 +1,221 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Predictor.h"
+#include "Tree.h"
+#include "json.hpp"
+
+using json = nlohmann::json;
+using namespace std;
+
+// Emits one straight-line nested `if` per node. Bounds have the scaler and
+// the 1e-5 tie rule folded in (Tree::bound) and are printed as hex floats,
+// so the generated code decides exactly like Predictor::predict.
+static void emit_node(FILE* out, const Tree& tree, int node, int indent) {
+    const string pad(indent * 4, ' ');
+
+    if (tree.get_children_left()[node] == -1) {
+        const auto& value = tree.get_value()[node];
+        fprintf(out, "%sno += %a;\n", pad.c_str(), get<0>(value));
+        fprintf(out, "%syes += %a;\n", pad.c_str(), get<1>(value));
+        return;
+    }
+
+    fprintf(out, "%sif (x[%d] <= %a) {\n", pad.c_str(),
+        tree.get_feature()[node], tree.bound(node));
+    emit_node(out, tree, tree.get_children_left()[node], indent + 1);
+    fprintf(out, "%s} else {\n", pad.c_str());
+    emit_node(out, tree, tree.get_children_right()[node], indent + 1);
+    fprintf(out, "%s}\n", pad.c_str());
+}
+
+// Early-exit tables of the forest's arena (see VoteSwing)
+struct SwingTables {
+    vector<double> rest_min;
+    vector<double> rest_max;
+    double slack;
+
+    explicit SwingTables(const Forest& forest) {
+        const auto& order = forest.get_eval_order();
+
+        this->slack = compute_vote_swing(
+            forest.get_arena(), forest.get_roots().data(), forest.get_roots().size(), this->rest_min, this->rest_max,
+            order.empty() ? nullptr : order.data()
+        );
+    }
+};
+
+static void emit_model(FILE* out, const Predictor& predictor, const string& source) {
+    const auto& forest = predictor.get_forest();
+    const auto& trees = forest.get_trees();
+    const SwingTables swing(forest);
+    const int yes_class = forest.get_classes()[1];
+    const int no_class = forest.get_classes()[0];
+
+    fprintf(out, "// Generated by forest_codegen from %s. Do not edit.\n", source.c_str());
+    fprintf(out, "#include <stdexcept>\n\n");
+    fprintf(out, "#include \"CompiledModel.h\"\n\n");
+
+    fprintf(out, "namespace {\n\n");
+    for (size_t t = 0; t < trees.size(); t++) {
+        fprintf(out, "inline void tree_%zu(const FeatureArray& x, double& no, double& yes) {\n", t);
+        emit_node(out, trees[t], 0, 1);
+        fprintf(out, "}\n\n");
+    }
+    fprintf(out, "}\n\n");
+
+    fprintf(out, "int compiled_model::predict(const FeatureArray& x) {\n");
+    fprintf(out, "    double no = 0.0;\n");
+    fprintf(out, "    double yes = 0.0;\n\n");
+    const auto& order = forest.get_eval_order();
+    for (size_t k = 0; k < trees.size(); k++) {
+        // Same early exit as arena_vote, with the remaining swing inlined
+        fprintf(out, "    tree_%u(x, no, yes);\n", order.empty() ? uint32_t(k) : order[k]);
+        if (k + 1 < trees.size() || !order.empty()) {
+            fprintf(out, "    if (yes - no + %a > %a) return %d;\n", swing.rest_min[k + 1], swing.slack, yes_class);
+            fprintf(out, "    if (yes - no + %a < %a) return %d;\n", swing.rest_max[k + 1], -swing.slack, no_class);
+        }
+    }
+    if (!order.empty()) {
+        // Too close to call out of order: the sum in tree order decides
+        fprintf(out, "\n    no = 0.0;\n");
+        fprintf(out, "    yes = 0.0;\n");
+        for (size_t t = 0; t < trees.size(); t++) {
+            fprintf(out, "    tree_%zu(x, no, yes);\n", t);
+        }
+    }
+    fprintf(out, "\n    return yes >= no ? %d : %d;\n", yes_class, no_class);
+    fprintf(out, "}\n\n");
+
+    fprintf(out, "void compiled_model::predict_batch(std::span<const FeatureArray> x, std::span<int> out) {\n");
+    fprintf(out, "    if (x.size() != out.size()) {\n");
+    fprintf(out, "        throw std::invalid_argument(\"predict_batch needs one output slot per sample\");\n");
+    fprintf(out, "    }\n\n");
+    fprintf(out, "    for (size_t i = 0; i < x.size(); i++) {\n");
+    fprintf(out, "        out[i] = predict(x[i]);\n");
+    fprintf(out, "    }\n");
+    fprintf(out, "}\n");
+}
+
+static void emit_doubles(FILE* out, const char* name, const vector<double>& values) {
+    fprintf(out, "inline constexpr double %s[] = {\n", name);
+    for (auto value: values) {
+        fprintf(out, "    %a,\n", value);
+    }
+    fprintf(out, "};\n\n");
+}
+
+// Emits the packed ForestNode arena, scaler folded in, and its early-exit
+// tables as constexpr arrays, plus a constinit ModelView over them
+static void emit_tables(FILE* out, const Predictor& predictor, const string& source) {
+    const auto& forest = predictor.get_forest();
+    const SwingTables swing(forest);
+    const auto* arena = forest.get_arena();
+    const auto& roots = forest.get_roots();
+    const auto& classes = forest.get_classes();
+
+    fprintf(out, "// Generated by forest_codegen --tables from %s. Do not edit;\n", source.c_str());
+    fprintf(out, "// regenerate with `make model-tables`.\n");
+    fprintf(out, "#pragma once\n\n");
+    fprintf(out, "#include <cstdint>\n\n");
+    fprintf(out, "#include \"ModelView.h\"\n\n");
+    fprintf(out, "namespace model_tables {\n\n");
+
+    fprintf(out, "static_assert(N_FEATURES == %d, \"model expects %d features\");\n\n",
+        forest.get_n_features(), forest.get_n_features());
+
+    fprintf(out, "inline constexpr int classes[2] = {%d, %d};\n\n", classes[0], classes[1]);
+
+    fprintf(out, "inline constexpr size_t n_trees = %zu;\n", roots.size());
+    fprintf(out, "inline constexpr size_t n_nodes = %zu;\n\n", forest.arena_size());
+
+    fprintf(out, "alignas(64) inline constexpr ForestNode nodes[] = {\n");
+    for (size_t i = 0; i < forest.arena_size(); i++) {
+        const auto& node = arena[i];
+        fprintf(out, "    {%a, %d, %u, {%a, %a}},\n",
+            node.bound, node.feature, node.left, node.votes[0], node.votes[1]);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "inline constexpr uint32_t roots[] = {\n");
+    for (auto root: roots) {
+        fprintf(out, "    %u,\n", root);
+    }
+    fprintf(out, "};\n\n");
+
+    emit_doubles(out, "vote_rest_min", swing.rest_min);
+    emit_doubles(out, "vote_rest_max", swing.rest_max);
+    fprintf(out, "inline constexpr double vote_slack = %a;\n\n", swing.slack);
+
+    const auto& order = forest.get_eval_order();
+    if (!order.empty()) {
+        fprintf(out, "// Early-exit visiting order from Forest::reorder_trees\n");
+        fprintf(out, "inline constexpr uint32_t eval_order[] = {\n");
+        for (auto t: order) {
+            fprintf(out, "    %u,\n", t);
+        }
+        fprintf(out, "};\n\n");
+    }
+
+    fprintf(out, "static_assert(sizeof(nodes) / sizeof(nodes[0]) == n_nodes, \"node count mismatch\");\n");
+    fprintf(out, "static_assert(sizeof(roots) / sizeof(roots[0]) == n_trees, \"tree count mismatch\");\n");
+    fprintf(out, "static_assert(sizeof(vote_rest_min) / sizeof(double) == n_trees + 1, \"swing table mismatch\");\n");
+    fprintf(out, "static_assert(sizeof(vote_rest_max) / sizeof(double) == n_trees + 1, \"swing table mismatch\");\n");
+    fprintf(out, "static_assert(ModelView(nodes, n_nodes, roots, n_trees, classes).is_valid(),\n");
+    fprintf(out, "    \"node table has an out-of-range index\");\n\n");
+    fprintf(out, "}\n\n");
+
+    fprintf(out, "// Predictor over the tables above; starting the process allocates and parses nothing\n");
+    fprintf(out, "inline constinit const ModelView embedded_model(\n");
+    fprintf(out, "    model_tables::nodes,\n");
+    fprintf(out, "    model_tables::n_nodes,\n");
+    fprintf(out, "    model_tables::roots,\n");
+    fprintf(out, "    model_tables::n_trees,\n");
+    fprintf(out, "    model_tables::classes,\n");
+    fprintf(out, "    VoteSwing{model_tables::vote_rest_min, model_tables::vote_rest_max, model_tables::vote_slack, %s}\n",
+        forest.get_eval_order().empty() ? "nullptr" : "model_tables::eval_order");
+    fprintf(out, ");\n");
+}
+
+int main(int argc, char** argv) {
+    const bool tables = argc > 1 && string(argv[1]) == "--tables";
+    const int first = tables ? 2 : 1;
+
+    if (argc - first != 1 && argc - first != 2) {
+        printf("usage: %s [--tables] <output> [model_json]\n", argv[0]);
+        return -1;
+    }
+
+    Predictor predictor;
+    string source = "the embedded model";
+
+    if (argc - first == 2) {
+        ifstream model_fin(argv[first + 1]);
+        if (!model_fin.is_open()) {
+            printf("cannot open %s\n", argv[first + 1]);
+            return -1;
+        }
+
+        predictor = json::parse(model_fin).get<Predictor>();
+        source = argv[first + 1];
+    } else {
+        predictor = Predictor::LoadEmbedded();
+    }
+
+    FILE* out = fopen(argv[first], "w");
+    if (out == nullptr) {
+        printf("cannot write %s\n", argv[first]);
+        return -1;
+    }
+
+    if (tables) {
+        emit_tables(out, predictor, source);
+    } else {
+        emit_model(out, predictor, source);
+    }
+    fclose(out);
+
+    return 0;
+}
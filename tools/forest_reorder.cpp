@@ -0,0 +1,107 @@
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Predictor.h"
+#include "Sample.h"
+#include "json.hpp"
+
+using json = nlohmann::json;
+using namespace std;
+
+static vector<FeatureArray> read_rows(const string& path) {
+    ifstream fin(path);
+    if (!fin.is_open()) {
+        throw runtime_error("cannot open " + path);
+    }
+
+    vector<FeatureArray> rows;
+    string line;
+    getline(fin, line);
+
+    while (getline(fin, line)) {
+        if (!line.empty()) {
+            rows.push_back(Sample::from_line(line).to_array());
+        }
+    }
+
+    return rows;
+}
+
+// Model-preparation pass: runs Forest::reorder_trees on the rows of every
+// calibration CSV and writes the model back with its early-exit visiting
+// order. Reports the mean trees walked per row, before and after, per CSV.
+int main(int argc, char** argv) {
+    string model_file = "";
+    int arg = 1;
+
+    if (arg + 1 < argc && string(argv[arg]) == "--model") {
+        model_file = argv[arg + 1];
+        arg += 2;
+    }
+
+    if (argc - arg < 2) {
+        printf("usage: %s [--model <model_json>] <output_json> <calibration_csv>...\n", argv[0]);
+        return -1;
+    }
+
+    try {
+        json data;
+
+        if (!model_file.empty()) {
+            ifstream model_fin(model_file);
+            if (!model_fin.is_open()) {
+                printf("cannot open %s\n", model_file.c_str());
+                return -1;
+            }
+
+            data = json::parse(model_fin);
+        } else {
+            data = Predictor::EmbeddedJson();
+        }
+
+        // any previous order is dropped and chosen afresh
+        data["model"].erase("eval_order");
+        data["model"].erase("expected_trees_evaluated");
+
+        const Forest before = data.get<Predictor>().get_forest();
+        Forest after = before;
+
+        vector<vector<FeatureArray>> sets;
+        vector<FeatureArray> calibration;
+        for (int i = arg + 1; i < argc; i++) {
+            sets.push_back(read_rows(argv[i]));
+            calibration.insert(calibration.end(), sets.back().begin(), sets.back().end());
+        }
+
+        auto report = after.reorder_trees(calibration);
+
+        printf("%-40s %10s %10s\n", "mean trees evaluated", "before", "after");
+        for (size_t i = 0; i < sets.size(); i++) {
+            printf("%-40s %10.2f %10.2f\n", argv[arg + 1 + i],
+                before.mean_trees_evaluated(sets[i]), after.mean_trees_evaluated(sets[i]));
+        }
+        printf("%-40s %10.2f %10.2f\n", "all calibration rows", report.mean_trees_before, report.mean_trees_after);
+
+        if (!after.get_eval_order().empty()) {
+            data["model"]["eval_order"] = after.get_eval_order();
+            data["model"]["expected_trees_evaluated"] = after.get_expected_trees();
+        } else {
+            printf("no order beats the stored one; the model is written unchanged\n");
+        }
+
+        ofstream out(argv[arg]);
+        out << data.dump() << "\n";
+        if (!out.good()) {
+            printf("failed writing %s\n", argv[arg]);
+            return -1;
+        }
+    } catch (const exception& e) {
+        printf("%s\n", e.what());
+        return -1;
+    }
+
+    return 0;
+}
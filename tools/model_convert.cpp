@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+
+#include "BinaryModel.h"
+#include "Predictor.h"
+#include "json.hpp"
+
+using json = nlohmann::json;
+using namespace std;
+
+// Converts a model JSON (the layout from_json(const json&, Predictor&)
+// reads) or the embedded model to the memory-mappable binary format
+int main(int argc, char** argv) {
+    if (argc != 2 && argc != 3) {
+        printf("usage: %s <output_model> [model_json]\n", argv[0]);
+        return -1;
+    }
+
+    try {
+        Predictor predictor;
+
+        if (argc == 3) {
+            ifstream model_fin(argv[2]);
+            if (!model_fin.is_open()) {
+                printf("cannot open %s\n", argv[2]);
+                return -1;
+            }
+
+            predictor = json::parse(model_fin).get<Predictor>();
+        } else {
+            predictor = Predictor::LoadEmbedded();
+        }
+
+        write_binary_model(predictor, argv[1]);
+    } catch (const exception& e) {
+        printf("%s\n", e.what());
+        return -1;
+    }
+
+    return 0;
+}